@@ -58,11 +58,16 @@
 
 #include "core_pins.h"
 #include "control_sgtl5000.h"
+#include "block_tags.h"//Local version
 #include "effect_ensemble.h"
 #include "effect_envelope.h"//Local version
 #include "effect_combine.h"//Local version
 #include "filter_variable.h"//Local version
+#include "filter_ladder.h"//Local version
+#include "filter_dcblock.h"//Local version
 #include "mixer.h"
+#include "mixer_ts.h"//Local version
+#include "mixer_bus.h"//Local version
 #include "output_i2s.h"
 #include "synth_waveform.h"//Local version
 #include "synth_dc.h"
@@ -0,0 +1,189 @@
+#ifndef TSYNTH_AUDIO_GRAPH_H
+#define TSYNTH_AUDIO_GRAPH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// An audio graph described at compile time and compiled into an update
+// schedule.
+//
+// Nodes are AudioStream objects, numbered in the order they're declared,
+// edges are AudioConnections and control signal reads between them. The
+// Teensy Audio library updates objects in the order they were constructed
+// and a connection to an object that has already updated this cycle is
+// received a block late, so the schedule decides both the order and the
+// latency. compile() sorts the nodes so every source updates before the
+// objects reading it, except across FEEDBACK edges, which are the only
+// place a block of delay is allowed. Then each block passed between
+// objects is given a slot, reusing slots whose block has been released,
+// which gives the peak number of blocks the graph holds at once.
+namespace AudioGraph {
+
+enum EdgeKind : uint8_t {
+    AUDIO,    // an AudioConnection received in the same update
+    CONTROL,  // a control signal read, see control_signal.h: orders the
+              // nodes but carries no block
+    FEEDBACK  // an AudioConnection received one update later, the
+              // destination updates before the source
+};
+
+struct Edge {
+    uint16_t src;
+    uint8_t output;
+    uint16_t dst;
+    uint8_t input;
+    EdgeKind kind;
+};
+
+// How an object gets the block for its first output
+static const uint8_t NO_INPUT = 0xff;     // allocate() while it holds its inputs
+static const uint8_t FIRST_INPUT = 0xfe;  // receiveWritable() on its lowest audio input, as the mixers do
+static const uint8_t ALL_INPUTS = 0xfd;   // releases every input before it allocates
+                                          // any other value: receiveWritable() on that input
+
+struct Node {
+    const char *name;
+    uint8_t instance;
+    uint8_t inPlace = NO_INPUT;
+    uint8_t held = 0;  // blocks kept from one update to the next, e.g. output queues
+};
+
+static const uint8_t NO_BLOCK = 0xff;
+static const uint16_t UNSCHEDULED = 0xffff;
+
+template <size_t NODES, size_t EDGES>
+struct Graph {
+    Node nodes[NODES];
+    Edge edges[EDGES];
+};
+
+template <size_t NODES, size_t EDGES>
+struct Schedule {
+    uint16_t order[NODES];  // node updated at each step
+    uint16_t step[NODES];   // step each node updates at
+    uint8_t block[EDGES];   // slot holding the block on each edge, NO_BLOCK for CONTROL
+    uint8_t blocks;         // slots used, the peak number of live blocks
+    uint16_t held;          // blocks held inside objects, on top of the slots
+    bool acyclic;           // false if a cycle has no FEEDBACK edge to break it
+    bool inNodeOrder;       // the nodes' own numbering is an update order
+};
+
+// Node that must update first for an edge
+constexpr uint16_t before(const Edge &e)
+{
+    return e.kind == FEEDBACK ? e.dst : e.src;
+}
+
+constexpr uint16_t after(const Edge &e)
+{
+    return e.kind == FEEDBACK ? e.src : e.dst;
+}
+
+template <size_t NODES, size_t EDGES>
+constexpr Schedule<NODES, EDGES> compile(const Graph<NODES, EDGES> &g)
+{
+    Schedule<NODES, EDGES> s{};
+    uint16_t pending[NODES] = {};
+    for (size_t e = 0; e < EDGES; e++) pending[after(g.edges[e])]++;
+    for (size_t n = 0; n < NODES; n++) s.step[n] = UNSCHEDULED;
+
+    // Topological sort taking the lowest numbered ready node each step, so
+    // a graph that is already in order keeps its node order
+    s.inNodeOrder = true;
+    for (size_t n = 0; n < NODES; n++) {
+        size_t next = NODES;
+        for (size_t i = 0; i < NODES; i++) {
+            if (s.step[i] == UNSCHEDULED && pending[i] == 0) {
+                next = i;
+                break;
+            }
+        }
+        if (next == NODES) return s;
+        s.order[n] = next;
+        s.step[next] = n;
+        if (next != n) s.inNodeOrder = false;
+        for (size_t e = 0; e < EDGES; e++) {
+            if (before(g.edges[e]) == next) pending[after(g.edges[e])]--;
+        }
+    }
+    s.acyclic = true;
+
+    // Liveness: each source output holds one block from the step it is
+    // sent until its last reader. A FEEDBACK block is read in the next
+    // cycle, its interval runs past the end and wraps round to the reader.
+    uint16_t first[EDGES] = {};  // first edge carrying the same block
+    uint16_t start[EDGES] = {};
+    uint16_t end[EDGES] = {};
+    for (size_t e = 0; e < EDGES; e++) {
+        const Edge &edge = g.edges[e];
+        s.block[e] = NO_BLOCK;
+        if (edge.kind == CONTROL) continue;
+        const uint16_t last = s.step[edge.dst] + (edge.kind == FEEDBACK ? NODES : 0);
+        first[e] = e;
+        for (size_t f = 0; f < e; f++) {
+            if (g.edges[f].kind != CONTROL && g.edges[f].src == edge.src && g.edges[f].output == edge.output) {
+                first[e] = f;
+                break;
+            }
+        }
+        if (first[e] == e) {
+            start[e] = s.step[edge.src];
+            end[e] = last;
+        } else if (last > end[first[e]]) {
+            end[first[e]] = last;
+        }
+    }
+
+    // Slots are handed out in step order, lowest free slot first. Blocks
+    // taken earlier in a slot all start before this one, so it's free if
+    // they've all been released and, for a block that wraps round, none of
+    // them started before it is read in the next cycle. A slot ending at
+    // this step holds one of the node's inputs, read by nothing after it:
+    // the first output can take it over when the node works in place.
+    uint16_t slotEnd[EDGES] = {};
+    uint16_t slotStart[EDGES] = {};
+    for (size_t n = 0; n < NODES; n++) {
+        const uint16_t node = s.order[n];
+        uint8_t inPlace = g.nodes[node].inPlace;
+        uint8_t reuse = NO_BLOCK;
+        s.held += g.nodes[node].held;
+        if (inPlace == FIRST_INPUT) {
+            inPlace = NO_INPUT;
+            for (size_t e = 0; e < EDGES; e++) {
+                if (g.edges[e].dst == node && g.edges[e].kind != CONTROL && g.edges[e].input < inPlace) inPlace = g.edges[e].input;
+            }
+        }
+        if (inPlace != NO_INPUT && inPlace != ALL_INPUTS) {
+            for (size_t e = 0; e < EDGES; e++) {
+                if (g.edges[e].dst == node && g.edges[e].input == inPlace && g.edges[e].kind == AUDIO
+                    && s.block[first[e]] != NO_BLOCK && slotEnd[s.block[first[e]]] == n) reuse = s.block[first[e]];
+            }
+        }
+        bool reused = false;
+        for (size_t e = 0; e < EDGES; e++) {
+            if (g.edges[e].kind == CONTROL || first[e] != e || g.edges[e].src != node) continue;
+            uint8_t slot = 0;
+            if (reuse != NO_BLOCK && !reused) {
+                slot = reuse;
+            } else {
+                while (slot < s.blocks && (slotEnd[slot] > n || (slotEnd[slot] == n && inPlace != ALL_INPUTS) ||
+                       (end[e] >= NODES && end[e] - NODES >= slotStart[slot]))) slot++;
+            }
+            reused = true;
+            if (slot == s.blocks) {
+                slotStart[slot] = start[e];
+                s.blocks++;
+            }
+            slotEnd[slot] = end[e];
+            s.block[e] = slot;
+        }
+    }
+    for (size_t e = 0; e < EDGES; e++) {
+        if (g.edges[e].kind != CONTROL) s.block[e] = s.block[first[e]];
+    }
+    return s;
+}
+
+}
+
+#endif
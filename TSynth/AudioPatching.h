@@ -3,181 +3,298 @@
 
 #include <vector>
 #include "Constants.h"
+#include "SynthGraph.h"
 
-//waveformX      -->   waveformMixerX   -->   voiceMixer1-3   -->   voiceMixerM  --> volumeMixer
-//WAVEFORMLEVEL        oscA/BLevel             VELOCITY    VOICEMIXERLEVEL/UNISONVOICEMIXERLEVEL    volume
+//waveformX      -->   waveformMixerX   -->   voiceMixer                                    --> volumeMixer
+//WAVEFORMLEVEL        oscA/BLevel             VELOCITY * VOICEMIXERLEVEL/UNISONVOICEMIXERLEVEL,
+//                                             then VOICEMIXERLEVEL for the whole bus                volume
 
+// A timbre's voices summed on one bus, see mixer_bus.h
+typedef AudioMixerBusTS<SynthGraph::VOICES_PER_GROUP> VoiceMixer;
+
+// A voice's input on its voice mixer. Each Patch owns one and points it
+// at an input when it is connected, so moving a voice allocates nothing.
 class Mixer {
     private:
-    AudioMixer4& mixer;
-    uint8_t index;
+    VoiceMixer *mixer = nullptr;
+    uint8_t index = 0;
 
     public:
-    Mixer(AudioMixer4& mixer_, uint8_t index_): mixer(mixer_), index(index_) {}
+    void set(VoiceMixer& mixer_, uint8_t index_) {
+        mixer = &mixer_;
+        index = index_;
+    }
 
     void gain(float value) {
-        mixer.gain(index, value);
+        if (mixer) mixer->gain(index, value);
+    }
+};
+
+// Connections made at run time are members of the struct they belong
+// to, one set per timbre or voice, and are moved by relinking them rather
+// than with new/delete: nothing is allocated after setup().
+inline void relink(AudioConnection& connection, AudioStream& source, uint8_t output, AudioStream& destination, uint8_t input) {
+    connection.disconnect();
+    connection.connect(source, output, destination, input);
+}
+
+// A noise generator shared by every timbre. It only runs while at least one
+// timbre has its level up, otherwise it sends nothing and the noise
+// mixers and waveform mixers downstream see silence.
+template <class T>
+struct SharedNoise {
+    T source;
+    uint8_t users = 0;
+
+    void use(bool enable) {
+        if (enable) {
+            if (users++ == 0) source.amplitude(1.0);
+        } else if (users > 0 && --users == 0) {
+            source.amplitude(0);
+        }
     }
 };
 
+// Makes a struct's fixed connections from its link table in SynthGraph.h
+template <class T, size_t N>
+void connectLinks(AudioConnection (&connections)[N], const AudioGraph::Edge (&links)[N], T &owner) {
+    for (size_t i = 0; i < N; i++) {
+        connections[i].connect(owner.node(links[i].src), links[i].output, owner.node(links[i].dst), links[i].input);
+    }
+}
+
+// The voices of a timbre mixed down, through the ensemble to the outputs.
+// Declared after every voice, see SynthGraph.h.
+struct PatchBus {
+    VoiceMixer voiceMixer;
+
+    AudioFilterDCBlockTS dcOffsetFilter;
+    AudioMixer4 volumeMixer;
+    AudioEffectEnsemble ensemble;
+    AudioMixer4 effectMixerL;
+    AudioMixer4 effectMixerR;
+
+    AudioConnection connections[SynthGraph::count(SynthGraph::busLinks)];
+
+    AudioStream &node(uint8_t id) {
+        switch (id) {
+            case SynthGraph::VOICE_MIXER: return voiceMixer;
+            case SynthGraph::DC_OFFSET_FILTER: return dcOffsetFilter;
+            case SynthGraph::VOLUME_MIXER: return volumeMixer;
+            case SynthGraph::ENSEMBLE: return ensemble;
+            case SynthGraph::EFFECT_MIXER_L: return effectMixerL;
+            default: return effectMixerR;
+        }
+    }
+
+    PatchBus() {
+        connectLinks(connections, SynthGraph::busLinks, *this);
+    }
+
+    private:
+    AudioConnection outputLConnection;
+    AudioConnection outputRConnection;
+
+    public:
+    // Onto the stereo output mixer as its source index
+    void connectOutput(AudioStream& output, uint8_t index) {
+        relink(outputLConnection, effectMixerL, 0, output, index * 2);
+        relink(outputRConnection, effectMixerR, 0, output, index * 2 + 1);
+    }
+};
+
+// Modulation sources shared by the voices of a timbre. Declared before
+// every voice, see SynthGraph.h.
 struct PatchShared {
     AudioSynthWaveformDcTS pitchBend;
     AudioSynthWaveformTS pitchLfo;
-    AudioMixer4 pitchMixer;
+    AudioMixer4TS pitchMixer;
     AudioSynthWaveformTS pwmLfoA;
     AudioSynthWaveformTS pwmLfoB;
     AudioSynthWaveformTS filterLfo;
     AudioSynthWaveformDcTS pwa;
     AudioSynthWaveformDcTS pwb;
-    AudioMixer4 noiseMixer;
-
-    AudioMixer4 voiceMixer[3];
-    AudioMixer4 voiceMixerM;
-
-    AudioEffectEnsemble ensemble;
-    AudioFilterStateVariableTS dcOffsetFilter;
-    AudioMixer4 volumeMixer;
-    AudioMixer4 effectMixerL;
-    AudioMixer4 effectMixerR;
+    AudioMixer4TS noiseMixer;
+
+    // Envelope times and curves for every voice in the group
+    AudioEnvelopeCoefsTS filterEnvelopeCoefs;
+    AudioEnvelopeCoefsTS ampEnvelopeCoefs;
+
+    // Where this timbre's voices are mixed, see connectBus()
+    PatchBus *bus = nullptr;
+
+    AudioConnection connections[SynthGraph::count(SynthGraph::modulationLinks)];
+
+    AudioStream &node(uint8_t id) {
+        switch (id) {
+            case SynthGraph::PITCH_BEND: return pitchBend;
+            case SynthGraph::PITCH_LFO: return pitchLfo;
+            case SynthGraph::PITCH_MIXER: return pitchMixer;
+            case SynthGraph::PWM_LFO_A: return pwmLfoA;
+            case SynthGraph::PWM_LFO_B: return pwmLfoB;
+            case SynthGraph::FILTER_LFO: return filterLfo;
+            case SynthGraph::PWA: return pwa;
+            case SynthGraph::PWB: return pwb;
+            default: return noiseMixer;
+        }
+    }
 
-    AudioConnection connections[12] = {
-        {pitchBend, 0, pitchMixer, 0},
-        {pitchLfo, 0, pitchMixer, 1},
-        {voiceMixer[0], 0, voiceMixerM, 0},
-        {voiceMixer[1], 0, voiceMixerM, 1},
-        {voiceMixer[2], 0, voiceMixerM, 2},
-        {voiceMixerM, 0, dcOffsetFilter, 0},
-        {dcOffsetFilter, 2, volumeMixer, 0},
-        {volumeMixer, 0, ensemble, 0},
-        {ensemble, 0, effectMixerL, 1},
-        {ensemble, 1, effectMixerR, 1},
-        {volumeMixer, 0, effectMixerL, 0},
-        {volumeMixer, 0, effectMixerR, 0},
-    };
+    PatchShared() {
+        connectLinks(connections, SynthGraph::modulationLinks, *this);
+        // Pitch bend is read as a control rate signal, see control_signal.h
+        pitchMixer.control(0, pitchBend.controlSignal());
+    }
 
     private:
-    AudioConnection *pinkNoiseConnection = nullptr;
-    AudioConnection *whiteNoiseConnection = nullptr;
-    AudioConnection *outputLConnection = nullptr;
-    AudioConnection *outputRConnection = nullptr;
+    AudioConnection pinkNoiseConnection;
+    AudioConnection whiteNoiseConnection;
+    SharedNoise<AudioSynthNoisePink> *pinkNoise = nullptr;
+    SharedNoise<AudioSynthNoiseWhite> *whiteNoise = nullptr;
+    bool pinkUsed = false;
+    bool whiteUsed = false;
+
+    template <class T>
+    static void useNoise(SharedNoise<T> *noise, bool &used, bool enable) {
+        if (used == enable) return;
+        used = enable;
+        if (noise) noise->use(enable);
+    }
 
     public:
     
-    void connectNoise(AudioSynthNoisePink& pink, AudioSynthNoiseWhite& white) {
-        delete pinkNoiseConnection;
-        delete whiteNoiseConnection;
-        pinkNoiseConnection = new AudioConnection(pink, 0, noiseMixer, 0);
-        whiteNoiseConnection = new AudioConnection(white, 0, noiseMixer, 1);
+    void connectNoise(SharedNoise<AudioSynthNoisePink>& pink, SharedNoise<AudioSynthNoiseWhite>& white) {
+        relink(pinkNoiseConnection, pink.source, 0, noiseMixer, 0);
+        relink(whiteNoiseConnection, white.source, 0, noiseMixer, 1);
+        pinkNoise = &pink;
+        whiteNoise = &white;
+    }
+
+    void connectBus(PatchBus& b) {
+        bus = &b;
+    }
+
+    // Noise levels for this timbre, starting or stopping the shared
+    // generators as the first user turns up or the last one turns down
+    void pinkNoiseGain(float gain) {
+        noiseMixer.gain(0, gain);
+        useNoise(pinkNoise, pinkUsed, gain != 0.0f);
     }
 
-    void connectOutput(AudioMixer4& left, AudioMixer4& right, uint8_t index) {
-        delete outputLConnection;
-        delete outputRConnection;
-        outputLConnection = new AudioConnection(effectMixerL, 0, left, index);
-        outputRConnection = new AudioConnection(effectMixerR, 0, right, index);
+    void whiteNoiseGain(float gain) {
+        noiseMixer.gain(1, gain);
+        useNoise(whiteNoise, whiteUsed, gain != 0.0f);
     }
 };
 
-// Oscillator configurations.
+// Oscillator configurations: one voice's objects in SynthGraph::voiceNodes
+// order, its connections and its place on a timbre's bus.
 struct Patch {
     AudioEffectEnvelopeTS filterEnvelope_;
 
-    AudioMixer4 pwMixer_a;
-    AudioMixer4 pwMixer_b;
+    AudioMixer4TS pwMixer_a;
+    AudioMixer4TS pwMixer_b;
 
     AudioSynthWaveformDcTS glide_;
 
     AudioSynthWaveformDcTS keytracking_;
 
-    AudioMixer4 oscModMixer_a;
-    AudioMixer4 oscModMixer_b;
+    AudioMixer4TS oscModMixer_a;
+    AudioMixer4TS oscModMixer_b;
 
-    AudioSynthWaveformModulatedTS waveformMod_a;
-    AudioSynthWaveformModulatedTS waveformMod_b;
+    // Both oscillators with their levels, cross mod, sync and XOR
+    AudioSynthWaveformDualTS oscillators_;
+    ModulatedOscillatorTS &waveformMod_a = oscillators_.a;
+    ModulatedOscillatorTS &waveformMod_b = oscillators_.b;
 
-    AudioEffectDigitalCombine oscFX_;
+    AudioMixer4TS waveformMixer_;
 
-    AudioMixer4 waveformMixer_;
-
-    AudioMixer4 filterModMixer_;
+    AudioMixer4TS filterModMixer_;
 
     AudioFilterStateVariableTS filter_;
 
+    AudioFilterLadderTS ladder_;
+
     AudioMixer4 filterMixer_;
 
     AudioEffectEnvelopeTS ampEnvelope_;
 
-    AudioConnection connections[25] = {
-        {keytracking_, 0, filterModMixer_, 2},
-        {pwMixer_a, 0, waveformMod_a, 1},
-        {pwMixer_b, 0, waveformMod_b, 1},
-        {waveformMod_a, 0, waveformMixer_, 0},
-        {waveformMod_a, 0, oscFX_, 0},
-        {waveformMod_b, 0, waveformMixer_, 1},
-        {waveformMod_b, 0, oscFX_, 1},
-        {filterEnvelope_, 0, filterModMixer_, 0},
-        {filterEnvelope_, 0, pwMixer_a, 2},
-        {filterEnvelope_, 0, pwMixer_b, 2},
-        {oscFX_, 0, waveformMixer_, 3},
-        {waveformMixer_, 0, filter_, 0},
-        {filterModMixer_, 0, filter_, 1},
-        {filter_, 0, filterMixer_, 0},
-        {filter_, 1, filterMixer_, 1},
-        {filter_, 2, filterMixer_, 2},
-        {filterMixer_, ampEnvelope_},
-        // Mod sources
-        {oscModMixer_a, 0, waveformMod_a, 0},
-        {oscModMixer_b, 0, waveformMod_b, 0},
-        // Pitch env
-        {filterEnvelope_, 0, oscModMixer_a, 1},
-        {filterEnvelope_, 0, oscModMixer_b, 1},
-        // Glide
-        {glide_, 0, oscModMixer_a, 2},
-        {glide_, 0, oscModMixer_b, 2},
-        // X Mod
-        {waveformMod_a, 0, oscModMixer_b, 3},
-        {waveformMod_b, 0, oscModMixer_a, 3}
-    };
+    AudioConnection connections[SynthGraph::count(SynthGraph::voiceLinks)];
+
+    AudioStream &node(uint8_t id) {
+        switch (id) {
+            case SynthGraph::FILTER_ENVELOPE: return filterEnvelope_;
+            case SynthGraph::PW_MIXER_A: return pwMixer_a;
+            case SynthGraph::PW_MIXER_B: return pwMixer_b;
+            case SynthGraph::GLIDE: return glide_;
+            case SynthGraph::KEYTRACKING: return keytracking_;
+            case SynthGraph::OSC_MOD_MIXER_A: return oscModMixer_a;
+            case SynthGraph::OSC_MOD_MIXER_B: return oscModMixer_b;
+            case SynthGraph::OSCILLATORS: return oscillators_;
+            case SynthGraph::WAVEFORM_MIXER: return waveformMixer_;
+            case SynthGraph::FILTER_MOD_MIXER: return filterModMixer_;
+            case SynthGraph::FILTER: return filter_;
+            case SynthGraph::LADDER: return ladder_;
+            case SynthGraph::FILTER_MIXER: return filterMixer_;
+            default: return ampEnvelope_;
+        }
+    }
+
+    // Only the selected filter gets audio, the other one skips its update
+    AudioConnection filterInput_{waveformMixer_, 0, filter_, 0};
+    AudioConnection ladderInput_;
+
+    void selectFilter(uint8_t type) {
+        filterInput_.disconnect();
+        ladderInput_.disconnect();
+        if (type == FILTERTYPELADDER) {
+            ladderInput_.connect(waveformMixer_, 0, ladder_, 0);
+        } else {
+            filterInput_.connect(waveformMixer_, 0, filter_, 0);
+        }
+    }
+
+    Patch() {
+        connectLinks(connections, SynthGraph::voiceLinks, *this);
+        // The filter envelope is a modulation source, it generates its
+        // curve rather than shaping a DC input
+        filterEnvelope_.generator(true);
+        // Keytracking and glide change once per note, they're read as
+        // control rate signals rather than audio blocks
+        filterModMixer_.control(2, keytracking_.controlSignal());
+        oscModMixer_a.control(2, glide_.controlSignal());
+        oscModMixer_b.control(2, glide_.controlSignal());
+    }
 
     private:
     // When added to a voice group, connect PWA/PWB.
-    AudioConnection *pitchMixerAConnection = nullptr;
-    AudioConnection *pitchMixerBConnection = nullptr;
-    AudioConnection *pwmLfoAConnection = nullptr;
-    AudioConnection *pwmLfoBConnection = nullptr;
-    AudioConnection *filterLfoConnection = nullptr;
-    AudioConnection *pwaConnection = nullptr;
-    AudioConnection *pwbConnection = nullptr;
-    AudioConnection *noiseMixerConnection = nullptr;
-    AudioConnection *ampConnection = nullptr;
+    AudioConnection pitchMixerAConnection;
+    AudioConnection pitchMixerBConnection;
+    AudioConnection pwmLfoAConnection;
+    AudioConnection pwmLfoBConnection;
+    AudioConnection filterLfoConnection;
+    AudioConnection noiseMixerConnection;
+    AudioConnection ampConnection;
+    Mixer mixer;
 
     public:
     // Connect the shared audio objects to the per-voice audio objects.
+    // Safe to call again to move the voice, see relink().
     Mixer* connectTo(PatchShared& shared, uint8_t index) {
-        delete pitchMixerAConnection;
-        delete pitchMixerBConnection;
-        delete pwmLfoAConnection;
-        delete pwmLfoBConnection;
-        delete filterLfoConnection;
-        delete pwaConnection;
-        delete pwbConnection;
-        delete noiseMixerConnection;
-        delete ampConnection;
-
-        pitchMixerAConnection = new AudioConnection(shared.pitchMixer, 0, oscModMixer_a, 0);
-        pitchMixerBConnection = new AudioConnection(shared.pitchMixer, 0, oscModMixer_b, 0);
-        pwmLfoAConnection = new AudioConnection(shared.pwmLfoA, 0, pwMixer_a, 0);
-        pwmLfoBConnection = new AudioConnection(shared.pwmLfoB, 0, pwMixer_b, 0);
-        filterLfoConnection = new AudioConnection(shared.filterLfo, 0, filterModMixer_, 1);
-        pwaConnection = new AudioConnection(shared.pwa, 0, pwMixer_a, 1);
-        pwbConnection = new AudioConnection(shared.pwb, 0, pwMixer_b, 1);
-        noiseMixerConnection = new AudioConnection(shared.noiseMixer, 0, waveformMixer_, 2);
-
-        uint8_t voiceMixerIndex = 0;
-        uint8_t indexMod4 = index % 4;
-        if (index != 0) voiceMixerIndex = index / 4;
-        ampConnection = new AudioConnection(ampEnvelope_, 0, shared.voiceMixer[voiceMixerIndex], indexMod4);
-        return new Mixer{shared.voiceMixer[voiceMixerIndex], indexMod4};
+        relink(pitchMixerAConnection, shared.pitchMixer, 0, oscModMixer_a, 0);
+        relink(pitchMixerBConnection, shared.pitchMixer, 0, oscModMixer_b, 0);
+        relink(pwmLfoAConnection, shared.pwmLfoA, 0, pwMixer_a, 0);
+        relink(pwmLfoBConnection, shared.pwmLfoB, 0, pwMixer_b, 0);
+        relink(filterLfoConnection, shared.filterLfo, 0, filterModMixer_, 1);
+        pwMixer_a.control(1, shared.pwa.controlSignal());
+        pwMixer_b.control(1, shared.pwb.controlSignal());
+        relink(noiseMixerConnection, shared.noiseMixer, 0, waveformMixer_, 2);
+
+        filterEnvelope_.useCoefs(&shared.filterEnvelopeCoefs);
+        ampEnvelope_.useCoefs(&shared.ampEnvelopeCoefs);
+
+        relink(ampConnection, ampEnvelope_, 0, shared.bus->voiceMixer, index);
+        mixer.set(shared.bus->voiceMixer, index);
+        return &mixer;
     }
 };
 
@@ -187,87 +304,127 @@ struct Global {
     static const uint8_t MAX_NO_VOICE = 12;
 
     public:
-    AudioOutputUSB           usbAudio;
-    AudioSynthWaveformDcTS     constant1Dc;
-    AudioSynthNoisePink      pink;
-    AudioSynthNoiseWhite     white;
-    AudioAnalyzePeak         peak;
-    Oscilloscope             scope;
-    AudioMixer4              effectMixerR[3];
-    AudioMixer4              effectMixerRM;
-    AudioMixer4              effectMixerL[3];
-    AudioMixer4              effectMixerLM;
-    AudioOutputI2S           i2s;
+    // In update order, see SynthGraph.h
+    SharedNoise<AudioSynthNoisePink> pink;
+    SharedNoise<AudioSynthNoiseWhite> white;
 
     PatchShared SharedAudio[MAX_NO_TIMBER];
     Patch Oscillators[MAX_NO_VOICE];
+    PatchBus SharedBus[MAX_NO_TIMBER];
 
-    AudioControlSGTL5000     sgtl5000_1;
+    AudioMixerBusTS<MAX_NO_TIMBER, 2> outputMixer;
+    AudioAnalyzePeak         peak;
+    Oscilloscope             scope;
+    AudioOutputUSB           usbAudio;
+    AudioOutputI2S           i2s;
 
-    AudioConnection connectionsArray[12] = {
-        {effectMixerL[0], 0, effectMixerLM, 0},
-        {effectMixerL[1], 0, effectMixerLM, 1},
-        {effectMixerL[2], 0, effectMixerLM, 2},
-        {effectMixerR[0], 0, effectMixerRM, 0},
-        {effectMixerR[1], 0, effectMixerRM, 1},
-        {effectMixerR[2], 0, effectMixerRM, 2},
-        {effectMixerLM, 0, scope, 0},
-        {effectMixerLM, 0, peak, 0},
-        {effectMixerRM, 0, usbAudio, 1},
-        {effectMixerRM, 0, i2s, 1},
-        {effectMixerLM, 0, i2s, 0},
-        {effectMixerLM, 0, usbAudio, 0}
-    };
-
-    std::vector<AudioConnection*> connections;
+    AudioControlSGTL5000     sgtl5000_1;
 
-    Global(float mixerLevel) {
-        for (uint8_t i = 0; i < MAX_NO_VOICE; i++) {
-            connections.push_back(new AudioConnection{constant1Dc, Oscillators[i].filterEnvelope_});
+    AudioConnection connectionsArray[SynthGraph::count(SynthGraph::outputLinks)];
+
+    typedef SynthGraph::Config<MAX_NO_TIMBER, MAX_NO_VOICE> Graph;
+
+    // SynthGraph's node numbering is an update order. This checks the
+    // graph, not the members above: they have to be declared in that
+    // numbering, group by group and each struct in its node list's order,
+    // which inUpdateOrder() checks.
+    static_assert(Graph::schedule().inNodeOrder,
+                  "SynthGraph's node order must be an update order, see SynthGraph.h");
+
+    // Blocks for AudioMemory(), the schedule's peak plus what the outputs
+    // hold and a margin, see SynthGraph::Config::audioMemory(). Only
+    // enough while inUpdateOrder(), otherwise blocks wait a cycle in input
+    // queues; AUDIO_MEMORY_UNPLANNED is the fixed pool from before.
+    static constexpr uint16_t AUDIO_MEMORY_BLOCKS = Graph::audioMemory();
+    static const uint16_t AUDIO_MEMORY_UNPLANNED = 60;
+
+    AudioStream &node(uint8_t id) {
+        switch (id) {
+            case SynthGraph::OUTPUT_MIXER: return outputMixer;
+            case SynthGraph::PEAK: return peak;
+            case SynthGraph::SCOPE: return scope;
+            case SynthGraph::USB_AUDIO: return usbAudio;
+            default: return i2s;
         }
+    }
 
-        for (uint8_t i = 0; i < MAX_NO_TIMBER; i++) {
-            SharedAudio[i].connectNoise(pink, white);
+    // The object for node id of instance's group, see SynthGraph::Config::nodeIndex()
+    AudioStream &node(SynthGraph::Group group, uint8_t instance, uint8_t id) {
+        switch (group) {
+            case SynthGraph::NOISE: return id == SynthGraph::PINK ? (AudioStream &)pink.source : white.source;
+            case SynthGraph::MODULATION: return SharedAudio[instance].node(id);
+            case SynthGraph::VOICE: return Oscillators[instance].node(id);
+            case SynthGraph::BUS: return SharedBus[instance].node(id);
+            default: return node(id);
+        }
+    }
 
-            uint8_t mixerIdx = 0;
-            if (i > 0) mixerIdx = i / 12;
-            SharedAudio[i].connectOutput(effectMixerL[mixerIdx], effectMixerR[mixerIdx], i % 4);
+    // True if the objects are constructed, so updated, in the schedule's
+    // order. Members are constructed in declaration order, which is also
+    // their address order, so each node's object has to sit after the one
+    // before it in schedule().order.
+    bool inUpdateOrder() {
+        static const uint8_t instances[] = {1, MAX_NO_TIMBER, MAX_NO_VOICE, MAX_NO_TIMBER, 1};
+        static const uint8_t nodes[] = {SynthGraph::NOISE_NODES, SynthGraph::MODULATION_NODES,
+                                        SynthGraph::VOICE_NODES, SynthGraph::BUS_NODES, SynthGraph::OUTPUT_NODES};
+        static constexpr auto schedule = Graph::schedule();
+        const AudioStream *at[Graph::NODES];
+        for (uint8_t g = SynthGraph::NOISE; g <= SynthGraph::OUTPUT; g++) {
+            const SynthGraph::Group group = (SynthGraph::Group)g;
+            for (uint8_t i = 0; i < instances[g]; i++) {
+                for (uint8_t id = 0; id < nodes[g]; id++) {
+                    at[schedule.step[Graph::nodeIndex(group, i, id)]] = &node(group, i, id);
+                }
+            }
+        }
+        for (uint16_t s = 1; s < Graph::NODES; s++) {
+            if (at[s] <= at[s - 1]) return false;
+        }
+        return true;
+    }
 
-            SharedAudio[i].voiceMixerM.gain(0, mixerLevel);
-            SharedAudio[i].voiceMixerM.gain(1, mixerLevel);
-            SharedAudio[i].voiceMixerM.gain(2, mixerLevel);
-            SharedAudio[i].voiceMixerM.gain(3, mixerLevel);
+    Global(float mixerLevel) {
+        connectLinks(connectionsArray, SynthGraph::outputLinks, *this);
 
-            SharedAudio[i].volumeMixer.gain(0, 1.6f);
-            SharedAudio[i].volumeMixer.gain(1, 0);
-            SharedAudio[i].volumeMixer.gain(2, 0);
-            SharedAudio[i].volumeMixer.gain(3, 0);
+        for (uint8_t i = 0; i < MAX_NO_TIMBER; i++) {
+            SharedAudio[i].connectNoise(pink, white);
+            SharedAudio[i].connectBus(SharedBus[i]);
+            SharedBus[i].connectOutput(outputMixer, i);
+            SharedBus[i].voiceMixer.gain(mixerLevel);
+
+            SharedBus[i].volumeMixer.gain(0, 1.6f);
+            SharedBus[i].volumeMixer.gain(1, 0);
+            SharedBus[i].volumeMixer.gain(2, 0);
+            SharedBus[i].volumeMixer.gain(3, 0);
             
             //This removes dc offset (mostly from unison pulse waves) before the ensemble effect
-            SharedAudio[i].dcOffsetFilter.octaveControl(1.0f);
-            SharedAudio[i].dcOffsetFilter.frequency(12.0f);//Lower values will give clicks on note on/off
+            SharedBus[i].dcOffsetFilter.frequency(12.0f);//Lower values will give clicks on note on/off
         }
 
-        constant1Dc.amplitude(1.0);
+        // Noise is off until a timbre turns it up, see SharedNoise
+        pink.source.amplitude(0);
+        white.source.amplitude(0);
+    }
 
-        effectMixerLM.gain(0, 1.0f);
-        effectMixerLM.gain(1, 1.0f);
-        effectMixerLM.gain(2, 1.0f);
-        effectMixerLM.gain(3, 1.0f);
-        effectMixerRM.gain(0, 1.0f);
-        effectMixerRM.gain(1, 1.0f);
-        effectMixerRM.gain(2, 1.0f);
-        effectMixerRM.gain(3, 1.0f);
+    // A voice stage's share of the audio update, every voice together, in
+    // the units of AudioProcessorUsage(): the most since the reset
+    float stageUsageMax(uint8_t id) {
+        float total = 0;
+        for (uint8_t v = 0; v < MAX_NO_VOICE; v++) total += Oscillators[v].node(id).processorUsageMax();
+        return total;
+    }
 
-        pink.amplitude(1.0);
-        white.amplitude(1.0);
+    void stageUsageMaxReset() {
+        for (uint8_t id = 0; id < SynthGraph::VOICE_NODES; id++) {
+            for (uint8_t v = 0; v < MAX_NO_VOICE; v++) Oscillators[v].node(id).processorUsageMaxReset();
+        }
     }
 
     inline uint8_t maxVoices() { return MAX_NO_VOICE; }
     inline uint8_t maxTimbre() { return MAX_NO_TIMBER; }
 
-    // Limited to 12 because we have 3 mixers funnelling into 1 mixer.
-    inline uint8_t maxVoicesPerGroup() { return 12; }
+    // The inputs on each timbre's voice mixer, see SynthGraph.h
+    inline uint8_t maxVoicesPerGroup() { return SynthGraph::VOICES_PER_GROUP; }
     inline uint8_t maxTimbres() { return 12; }
 };
 
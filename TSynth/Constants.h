@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stdint.h>
+#include "memory_placement.h"
 
 #ifndef UNIT_TEST
 #include "Arduino.h"
@@ -24,7 +25,7 @@ extern const float PROGMEM POWER[128];
 extern const float PROGMEM NOTEFREQS[128];
 extern const uint16_t PROGMEM ENVTIMES[128];
 extern const float PROGMEM LFOTEMPO[128];
-extern const String LFOTEMPOSTR[128];
+extern const char *const LFOTEMPOSTR[128];
 extern const uint8_t PROGMEM OSCMIXA[128];
 extern const uint8_t PROGMEM OSCMIXB[128];
 extern const int8_t PROGMEM PITCH[128];
@@ -40,9 +41,10 @@ extern const int8_t PROGMEM BANDPASS;
 extern const int8_t PROGMEM LOWPASS;
 extern const int8_t PROGMEM HIGHPASS;
 extern const float PROGMEM LINEAR_FILTERMIXER[128];
-extern const int16_t PROGMEM PARABOLIC_WAVE[256];
-extern const int16_t PROGMEM HARMONIC_WAVE[256];
-extern const int16_t PROGMEM PPG_WAVE[256];
+// Arbitrary waveforms, read by the oscillators every sample
+extern const int16_t FASTDATA PARABOLIC_WAVE[256];
+extern const int16_t FASTDATA HARMONIC_WAVE[256];
+extern const int16_t FASTDATA PPG_WAVE[256];
 extern const float PROGMEM AWFREQ;
 extern const float PROGMEM PWMRATE_PW_MODE;
 extern const float PROGMEM PWMRATE_SOURCE_FILTER_ENV;
@@ -52,6 +54,8 @@ extern const uint8_t PROGMEM MINUNISONVOICES;
 extern const float PROGMEM LFOMAXRATE;
 extern const uint8_t PROGMEM PWMSOURCELFO;
 extern const uint8_t PROGMEM PWMSOURCEFENV;
+extern const uint8_t PROGMEM FILTERTYPESVF;
+extern const uint8_t PROGMEM FILTERTYPELADDER;
 extern const float PROGMEM ONE;
 extern const float PROGMEM SGTL_MAXVOLUME;
 extern const float PROGMEM WAVEFORMLEVEL;
@@ -72,8 +76,8 @@ extern const char* INITPATCH;
 const static uint32_t WAVEFORM_PARABOLIC = 103;
 const static uint32_t WAVEFORM_HARMONIC = 104;
 
-extern const String SectionControls[9][4];
-extern const uint8_t PROGMEM WAVEFORMS_A[8];
-extern const uint8_t PROGMEM WAVEFORMS_B[8];
+extern const char *const SectionControls[9][4];
+extern const uint8_t PROGMEM WAVEFORMS_A[9];
+extern const uint8_t PROGMEM WAVEFORMS_B[9];
 extern const uint8_t PROGMEM WAVEFORMS_LFO[6];
 extern const uint8_t PROGMEM WAVEFORMS_LFO_MIDI[6];
@@ -13,11 +13,16 @@
 #define EEPROM_AMP_ENV 10
 #define EEPROM_FILT_ENV 11
 #define EEPROM_GLIDE_SHAPE 12
+#define EEPROM_QUALITY 13
 
 FLASHMEM void storeGlideShape(byte type){
   EEPROM.update(EEPROM_GLIDE_SHAPE, type);
 }
 
+FLASHMEM void storeQualityLevel(byte level){
+  EEPROM.update(EEPROM_QUALITY, level);
+}
+
 FLASHMEM void storeAmpEnv(byte type){
   EEPROM.update(EEPROM_AMP_ENV, type);
 }
@@ -32,6 +37,12 @@ FLASHMEM int8_t getGlideShape() {
   return gs;
 }
 
+FLASHMEM int8_t getQualityLevel() {
+  int8_t q = (int8_t)EEPROM.read(EEPROM_QUALITY);
+  if (q < 0 || q > 2) q = 1;//If EEPROM has no quality level (Normal)
+  return q;
+}
+
 FLASHMEM int8_t getAmpEnv() {
   int8_t ae = (int8_t)EEPROM.read(EEPROM_AMP_ENV);
   if (ae < -8 || ae > 8) ae = -128;//If EEPROM has no amp env (Lin type)
@@ -0,0 +1,59 @@
+#include <malloc.h>
+#include "HeapMonitor.h"
+
+namespace HeapMonitor {
+    volatile uint32_t allocations = 0;
+    uint32_t midiAllocations = 0;
+    uint32_t frameAllocations = 0;
+
+    static size_t setup = 0;
+    static size_t peak = 0;
+
+    size_t used() {
+        return mallinfo().uordblks;
+    }
+
+    size_t freeChunks() {
+        return mallinfo().ordblks;
+    }
+
+    void begin() {
+        setup = peak = used();
+        midiAllocations = 0;
+        frameAllocations = 0;
+    }
+
+    size_t setupUsed() {
+        return setup;
+    }
+
+    size_t peakUsed() {
+        return peak;
+    }
+
+    bool grew() {
+        const size_t now = used();
+        if (now <= peak) return false;
+        peak = now;
+        return true;
+    }
+}
+
+#ifdef COUNT_ALLOCATIONS
+// Linked with -Wl,--wrap=malloc -Wl,--wrap=realloc, every call to either
+// comes here first. free() isn't counted.
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    HeapMonitor::allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    HeapMonitor::allocations++;
+    return __real_realloc(ptr, size);
+}
+}
+#endif
@@ -0,0 +1,35 @@
+#ifndef TSYNTH_HEAP_MONITOR_H
+#define TSYNTH_HEAP_MONITOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Heap use after setup(). Once the voices are built nothing should
+// allocate: not handling MIDI, not drawing the display. The teensy41 build
+// wraps malloc() and realloc() (COUNT_ALLOCATIONS, see platformio.ini) so
+// every allocation is counted, even a String freed again straight away
+// that never shows in the heap's size. loop() adds up the allocations
+// made while it reads MIDI, the display thread those made while it draws
+// a frame. The two threads preempt each other, so a count can include the
+// other one's, but both should stay at 0.
+namespace HeapMonitor {
+    extern volatile uint32_t allocations;
+    extern uint32_t midiAllocations;
+    extern uint32_t frameAllocations;
+
+    // Bytes in use, and the number of free chunks between them: the heap's
+    // fragmentation
+    size_t used();
+    size_t freeChunks();
+
+    // At the end of setup()
+    void begin();
+
+    size_t setupUsed();
+    size_t peakUsed();
+
+    // True when heap use reached a new high since begin()
+    bool grew();
+}
+
+#endif
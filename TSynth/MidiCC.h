@@ -11,7 +11,7 @@
 #define   CCoscLevelA 20
 #define   CCoscLevelB 21
 #define   CCnoiseLevel  23
-#define   CCoscfx 24//Off/On
+#define   CCoscfx 24//Off/XOR/X Mod/Sync
 #define   CCpitchA 26
 #define   CCpitchB 27
 #define   CCpitchenv 28
@@ -43,5 +43,7 @@
 #define   CCfilterLFOMidiClkSync 104//Off/On
 #define   CCoscLFOMidiClkSync 105//Off/On - MIDI Only
 #define   CCpwmSource 106//LFO/Filter Env
+#define   CCfiltertype 107//State variable/Ladder
+#define   CCfiltercontrolrate 108//Cutoff worked out every 1/2/4/8/16/32/64 samples - MIDI Only
 #define   CCallnotesoff 123//Panic button
 #define   CCunison  126//Off/On
@@ -4,8 +4,16 @@
 #include "ST7735_t3.h"
 #include "Parameters.h"
 
+// The trace is 128 points, every 4th sample of the 512 after a block that
+// starts near zero, whatever the block size. It's redrawn at most once per
+// 128 samples, so smaller blocks don't draw more often.
+#define SCOPE_SAMPLES 128
+#define SCOPE_STRIDE 4
+#define SCOPE_DRAW_SAMPLES 128
+
 uint8_t bufferBlock = 0;
 uint8_t bufcount = 0;
+uint16_t drawSamples = 0;
 uint8_t pixel_x = 0;
 int16_t pixel_y = 0;
 int16_t prev_pixel_y = 0;
@@ -22,7 +30,7 @@ class Oscilloscope : public AudioStream {
   private:
     audio_block_t *inputQueueArray[1];
     ST7735_t3 *display;
-    int16_t buffer[AUDIO_BLOCK_SAMPLES];
+    int16_t buffer[SCOPE_SAMPLES];
 
 };
 #endif
@@ -41,7 +49,7 @@ void Oscilloscope::Display() {
   if (prev_pixel_y < minY) prev_pixel_y = minY;
   if (prev_pixel_y > maxY)prev_pixel_y = maxY;
 
-  for (uint8_t i = 0; i < AUDIO_BLOCK_SAMPLES - 1; i++) {
+  for (uint8_t i = 0; i < SCOPE_SAMPLES - 1; i++) {
     pixel_y = map(buffer[i], 32767, -32768, -120, 120) + Ymed;
     if (pixel_y < minY) pixel_y = minY;
     if (pixel_y > maxY)pixel_y = maxY;
@@ -55,33 +63,32 @@ void Oscilloscope::Display() {
 }
 
 void Oscilloscope::AddtoBuffer(int16_t *audio) {
-  audio++;
   if (bufferBlock == 0) {
-    if (*(audio - 1) > -16 && *(audio + 3) < 16) {
+    if (audio[0] > -16 && audio[SCOPE_STRIDE] < 16) {
       bufferBlock = 1;
       bufcount = 0;
     }
   }
   else {
-    for (uint16_t i = 0; i < 32; i++) {
-      buffer[bufcount++] = *audio;
-      audio += 4;
+    for (uint16_t i = 1; i < AUDIO_BLOCK_SAMPLES && bufcount < SCOPE_SAMPLES; i += SCOPE_STRIDE) {
+      buffer[bufcount++] = audio[i];
     }
-    bufferBlock++;
-    if (bufferBlock >= 5) {
+    if (bufcount >= SCOPE_SAMPLES) {
       bufferBlock = 0;
     }
   }
 }
 
-void Oscilloscope::update(void) {
+FASTRUN void Oscilloscope::update(void) {
   if (!display) return;
   audio_block_t *block;
   block = receiveReadOnly(0);
   if (block) {
     AddtoBuffer(block->data);
     release(block);
-    if (bufferBlock == 0) {
+    if (drawSamples < SCOPE_DRAW_SAMPLES) drawSamples += AUDIO_BLOCK_SAMPLES;
+    if (bufferBlock == 0 && drawSamples >= SCOPE_DRAW_SAMPLES) {
+      drawSamples = 0;
       Display();
     }
   }
@@ -17,7 +17,7 @@ long midiClkTimeInterval = 0;
 float lfoTempoValue = 1.0f;
 int pitchBendRange = 12;
 float modWheelDepth = 0.2f;
-String oscLFOTimeDivStr = "";//For display
+const char *oscLFOTimeDivStr = "";//For display
 int velocitySens = 0;//Default off - settings option
 // Exponential envelopes
 int8_t envTypeAmp=-128; // Linear
@@ -16,7 +16,7 @@ extern long midiClkTimeInterval;
 extern float lfoTempoValue;
 extern int pitchBendRange;
 extern float modWheelDepth;
-extern String oscLFOTimeDivStr;
+extern const char *oscLFOTimeDivStr;
 extern int velocitySens;
 // Exponential envelopes
 extern int8_t envTypeAmp;
@@ -6,13 +6,17 @@
 //Agileware CircularBuffer available in libraries manager
 #include <CircularBuffer.h>
 #include "Constants.h"
+#include "TextBuffer.h"
 
 #define TOTALCHARS 64
+#define PATCHNAMECHARS 12
+// Longest line of a patch file
+#define PATCH_DATA_CHARS 640
 
 const static char CHARACTERS[TOTALCHARS] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',' ', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', ' ', '1', '2', '3', '4', '5', '6', '7', '8', '9', '0'};
 int charIndex = 0;
 char currentCharacter = 0;
-String renamedPatch = "";
+TextBuffer<PATCHNAMECHARS + 1> renamedPatch;
 
 struct PatchNoAndName{
   int patchNo;
@@ -119,7 +123,7 @@ FLASHMEM void loadPatches(){
   sortPatches();
 }
 
-FLASHMEM void savePatch(const char *patchNo, String patchData){
+FLASHMEM void savePatch(const char *patchNo, const char *patchData){
   // Serial.print("savePatch Patch No:");
   //  Serial.println(patchNo);
   //Overwrite existing patch by deleting
@@ -149,7 +153,7 @@ FLASHMEM void savePatch(const char *patchNo, String patchData[]){
   {
     dataString = dataString + F(",") + patchData[i];
   }
-  savePatch(patchNo, dataString);
+  savePatch(patchNo, dataString.c_str());
 }
 
 FLASHMEM void deletePatch(const char *patchNo)
@@ -0,0 +1,122 @@
+#ifndef TSYNTH_QUALITY_H
+#define TSYNTH_QUALITY_H
+
+#include <stdint.h>
+#include "synth_waveform.h"
+
+// How much of the audio CPU the voices spend on sound quality. The level
+// set in Settings is the most the synth uses, QualityGovernor steps below
+// it while the audio update runs out of time and back when it recovers.
+enum Quality : uint8_t { QUALITY_ECO, QUALITY_NORMAL, QUALITY_HIGH, QUALITY_LEVELS };
+
+struct QualitySettings {
+    // Band-limited square, saw and pulse, or the naive ones that alias
+    bool bandLimited;
+    // AudioFilterStateVariableTS::oversample() and AudioFilterLadderTS::oversample()
+    uint8_t svfOversample;
+    bool ladderOversample;
+    // The patch's filter control rate, clamped to these, see
+    // VoiceGroup::setFilterControlRate()
+    uint8_t minControlRate;
+    uint8_t maxControlRate;
+};
+
+// The longest control rate AudioFilterStateVariableTS::controlRate() takes,
+// a block at most
+#define QUALITY_MAX_CONTROL_RATE (64 < AUDIO_BLOCK_SAMPLES ? 64 : AUDIO_BLOCK_SAMPLES)
+
+// Normal is what every patch was made with
+static const QualitySettings QUALITY_SETTINGS[QUALITY_LEVELS] = {
+    {false, 1, false, 16, QUALITY_MAX_CONTROL_RATE},
+    {true, 2, false, 1, QUALITY_MAX_CONTROL_RATE},
+    {true, 4, true, 1, 1},
+};
+
+// The display badge and the Settings value for each level
+static const char *const QUALITY_NAMES[QUALITY_LEVELS] = {"Eco", "Normal", "High"};
+
+// The waveform an oscillator set to waveform plays at a level: the naive
+// version of a band-limited one in eco
+inline uint32_t qualityWaveform(uint32_t waveform, Quality level) {
+    if (QUALITY_SETTINGS[level].bandLimited) return waveform;
+    switch (waveform) {
+        case WAVEFORM_BANDLIMIT_SQUARE: return WAVEFORM_SQUARE;
+        case WAVEFORM_BANDLIMIT_SAWTOOTH: return WAVEFORM_SAWTOOTH;
+        case WAVEFORM_BANDLIMIT_SAWTOOTH_REVERSE: return WAVEFORM_SAWTOOTH_REVERSE;
+        case WAVEFORM_BANDLIMIT_PULSE: return WAVEFORM_PULSE;
+        default: return waveform;
+    }
+}
+
+// Picks the level from the audio CPU usage, checked every CHECK_MS with
+// the highest AudioProcessorUsage() since the last check. One check over
+// STEP_DOWN_USAGE steps down a level. Stepping back up takes a run of
+// checks under STEP_UP_USAGE, and that run doubles each time the level
+// it went up to was too much for it straight away, so a patch sitting on
+// the edge of two levels doesn't flip between them.
+class QualityGovernor {
+  public:
+    static const uint16_t CHECK_MS = 100;
+    static constexpr float STEP_DOWN_USAGE = 85.0f;
+    static constexpr float STEP_UP_USAGE = 55.0f;
+    // 3 s, up to a minute
+    static const uint16_t RECOVER_CHECKS = 30;
+    static const uint16_t MAX_RECOVER_CHECKS = 600;
+
+    explicit QualityGovernor(Quality ceiling = QUALITY_NORMAL)
+        : current(ceiling), highest(ceiling), calm(0), probation(0), recover(RECOVER_CHECKS) {}
+
+    // The user's level: the most the governor goes to, and where it goes
+    // now
+    void setCeiling(Quality ceiling) {
+        highest = ceiling;
+        current = ceiling;
+        calm = 0;
+        probation = 0;
+        recover = RECOVER_CHECKS;
+    }
+
+    // One check's usage in percent, true if the level changed
+    bool update(float usage) {
+        if (probation > 0 && --probation == 0) {
+            // held the level it went up to
+            recover = RECOVER_CHECKS;
+        }
+        if (usage > STEP_DOWN_USAGE) {
+            calm = 0;
+            if (current == QUALITY_ECO) return false;
+            if (probation > 0) {
+                // straight back down: wait longer before the next try
+                recover = recover * 2 > MAX_RECOVER_CHECKS ? MAX_RECOVER_CHECKS : recover * 2;
+                probation = 0;
+            }
+            current = (Quality)(current - 1);
+            return true;
+        }
+        if (usage >= STEP_UP_USAGE || current == highest) {
+            calm = 0;
+            return false;
+        }
+        if (++calm < recover) return false;
+        calm = 0;
+        probation = recover;
+        current = (Quality)(current + 1);
+        return true;
+    }
+
+    Quality level() const { return current; }
+    Quality ceiling() const { return highest; }
+    // Below the user's level to keep up
+    bool throttled() const { return current < highest; }
+
+  private:
+    Quality current;
+    Quality highest;
+    // checks under STEP_UP_USAGE in a row
+    uint16_t calm;
+    // checks left in which stepping down counts against the last step up
+    uint16_t probation;
+    uint16_t recover;
+};
+
+#endif
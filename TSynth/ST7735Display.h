@@ -13,6 +13,8 @@
 #include <Adafruit_GFX.h>
 #include "ST7735_t3.h" // Local copy from TD1.48 that works for 0.96" IPS 160x80 display
 #include "Voice.h"
+#include "TextBuffer.h"
+#include "HeapMonitor.h"
 
 #include "Fonts/Org_01.h"
 #include "Yeysk16pt7b.h"
@@ -30,12 +32,14 @@
 
 ST7735_t3 tft = ST7735_t3(cs, dc, mosi, sclk, rst);
 
-String currentParameter = "";
-String currentValue = "";
+// Set from loop() and read by the display thread, fixed buffers so
+// neither side allocates
+TextBuffer<DISPLAY_CHARS> currentParameter;
+TextBuffer<DISPLAY_CHARS> currentValue;
 float currentFloatValue = 0.0;
-String currentPgmNum = "";
-String currentPatchName = "";
-String newPatchName = "";
+TextBuffer<DISPLAY_CHARS> currentPgmNum;
+TextBuffer<DISPLAY_CHARS> currentPatchName;
+TextBuffer<DISPLAY_CHARS> newPatchName;
 const char * currentSettingsOption = "";
 const char * currentSettingsValue = "";
 uint32_t currentSettingsPart = SETTINGS;
@@ -167,7 +171,7 @@ const __FlashStringHelper* printSection() {
     }
 }
 
-void alignRight(const String& str, int16_t x, int16_t y) {
+void alignRight(const char *str, int16_t x, int16_t y) {
     int16_t bx =0, by = 0;
     uint16_t bw=0, bh=0;
     tft.getTextBounds(str, 1, y, &bx, &by, &bw, &bh);
@@ -304,6 +308,12 @@ FLASHMEM void renderCurrentPatchPage() {
     tft.setCursor(123+1, 11);
     tft.println(F("CK"));
   }
+  // The quality level when it isn't Normal, red while stepped down for CPU
+  if (qualityGovernor.throttled() || qualityGovernor.level() != QUALITY_NORMAL) {
+    tft.fillRect(139, 6, 8, 7, qualityGovernor.throttled() ? TS_RED : TS_BLUE);
+    tft.setCursor(139+2, 11);
+    tft.print(QUALITY_NAMES[qualityGovernor.level()][0]);
+  }
   renderPeak();
 
 //    for (int j = 0; j < 5; ++j) {
@@ -567,8 +577,9 @@ FLASHMEM void renderRecallPage()
   patches.size() > 1 ? tft.println(patches[1].patchName) : tft.println(patches.last().patchName);
 }
 
-FLASHMEM void showRenamingPage(String newName) {
-  newPatchName = newName;
+template <class... T>
+FLASHMEM void showRenamingPage(const T &...newName) {
+  newPatchName.set(newName...);
 }
 
 FLASHMEM void renderUpDown(uint16_t  x, uint16_t  y, uint16_t  colour) {
@@ -593,29 +604,30 @@ FLASHMEM void renderSettingsPage() {
   if (currentSettingsPart == SETTINGSVALUE) renderUpDown(140, 80, ST7735_WHITE);
 }
 
-FLASHMEM void showCurrentParameterPage(String param, int pType, float val) {
-  currentParameter = param;
-  currentValue = String(val);
+// The parameter and value can be anything Print takes: F() and plain
+// strings, numbers or a TextBuffer from text()
+template <class P>
+FLASHMEM void showCurrentParameterPage(const P &param, int pType, float val) {
+  currentParameter.set(param);
+  currentValue.set(val);
   currentFloatValue = val;
   paramType = pType;
   startTimer();
 }
 
-FLASHMEM void showCurrentParameterPage(String param, String val, int pType) {
+template <class P, class V>
+FLASHMEM void showCurrentParameterPage(const P &param, const V &val, int pType = PARAMETER) {
   if (state == SETTINGS || state == SETTINGSVALUE)state = PARAMETER;//Exit settings page if showing
-  currentParameter = param;
-  currentValue = val;
+  currentParameter.set(param);
+  currentValue.set(val);
   paramType = pType;
   startTimer();
 }
 
-FLASHMEM void showCurrentParameterPage(String param, String val) {
-  showCurrentParameterPage(param, val, PARAMETER);
-}
-
-FLASHMEM void showPatchPage(String number, String patchName) {
-  currentPgmNum = number;
-  currentPatchName = patchName;
+template <class N, class P>
+FLASHMEM void showPatchPage(const N &number, const P &patchName) {
+  currentPgmNum.set(number);
+  currentPatchName.set(patchName);
 }
 
 FLASHMEM void showSettingsPage(const char *  option, const char * value, int settingsPart) {
@@ -632,6 +644,7 @@ void displayThread() {
 //  threads.delay(2000); //Give bootup page chance to display
   threads.delay(500); //Give bootup page chance to display
   while (1) {
+    const uint32_t allocations = HeapMonitor::allocations;
     switch (state) {
       case PARAMETER:
         if ((millis() - timer) > DISPLAYTIMEOUT) {
@@ -672,6 +685,7 @@ void displayThread() {
         break;
     }
     tft.updateScreen();
+    HeapMonitor::frameAllocations += HeapMonitor::allocations - allocations;
   }
 }
 
@@ -17,6 +17,7 @@ void settingsMonophonic(int index, const char * value);
 void settingsAmpEnv(int index, const char *value);
 void settingsFiltEnv(int index, const char *value);
 void settingsGlideShape(int index, const char *value);
+void settingsQuality(int index, const char *value);
 
 int currentIndexMIDICh();
 int currentIndexVelocitySens();
@@ -34,6 +35,7 @@ int currentIndexMonophonicMode();
 int currentIndexAmpEnv();
 int currentIndexFiltEnv();
 int currentIndexGlideShape();
+int currentIndexQuality();
 
 FLASHMEM int currentIndexGlideShape() {
   return glideShape;
@@ -49,6 +51,22 @@ FLASHMEM void settingsGlideShape(int index, const char * value) {
   storeGlideShape(glideShape); 
 }
 
+FLASHMEM int currentIndexQuality() {
+  return qualityGovernor.ceiling();
+}
+
+// The most the voices run at, QualityGovernor steps down from it while the
+// audio runs out of time
+FLASHMEM void settingsQuality(int index, const char * value) {
+  Quality level = QUALITY_NORMAL;
+  for (uint8_t i = 0; i < QUALITY_LEVELS; i++) {
+    if (strcmp(value, QUALITY_NAMES[i]) == 0) level = (Quality)i;
+  }
+  qualityGovernor.setCeiling(level);
+  applyQuality();
+  storeQualityLevel(level);
+}
+
 FLASHMEM int currentIndexAmpEnv() {
   if((envTypeAmp>=-8) && (envTypeAmp<=8))return envTypeAmp+9;
   else return 8;
@@ -59,6 +77,12 @@ FLASHMEM int currentIndexFiltEnv() {
   else return 8;
 }
 
+// Attack tables for the two curve types in use, before they're set
+FLASHMEM void buildAttackTables(){
+  const int8_t types[] = {envTypeAmp, envTypeFilt};
+  AudioEnvelopeCoefsTS::buildAttackTables(types, 2);
+}
+
 FLASHMEM void settingsAmpEnv(int index, const char * value) {
   if (strcmp(value, "Lin") == 0) envTypeAmp = -128;
   else if (strcmp(value, "Exp -8") == 0)  envTypeAmp = -8;
@@ -79,6 +103,7 @@ FLASHMEM void settingsAmpEnv(int index, const char * value) {
   else if (strcmp(value, "Exp +7") == 0)  envTypeAmp = 7;
   else if (strcmp(value, "Exp +8") == 0)  envTypeAmp = 8;
   else envTypeAmp = -128;
+  buildAttackTables();
   for (uint8_t i = 0; i < global.maxVoices(); i++) {
     global.Oscillators[i].ampEnvelope_.setEnvType(envTypeAmp);
   }
@@ -105,6 +130,7 @@ FLASHMEM void settingsFiltEnv(int index, const char * value) {
   else if (strcmp(value, "Exp +7") == 0)  envTypeFilt = 7;
   else if (strcmp(value, "Exp +8") == 0)  envTypeFilt = 8;
   else envTypeFilt = -128;
+  buildAttackTables();
   for (uint8_t i = 0; i < global.maxVoices(); i++) {
     global.Oscillators[i].filterEnvelope_.setEnvType(envTypeFilt);
   }
@@ -118,8 +144,14 @@ FLASHMEM void reloadGlideShape(){
   }
 }
 
+FLASHMEM void reloadQuality(){
+  qualityGovernor.setCeiling((Quality)getQualityLevel());
+  applyQuality();
+}
+
 FLASHMEM void reloadAmpEnv(){
   envTypeAmp = getAmpEnv();
+  buildAttackTables();
   for (uint8_t i = 0; i < global.maxVoices(); i++) {
     global.Oscillators[i].ampEnvelope_.setEnvType(envTypeAmp);
   }
@@ -127,6 +159,7 @@ FLASHMEM void reloadAmpEnv(){
 
 FLASHMEM void reloadFiltEnv(){
   envTypeFilt = getFiltEnv();
+  buildAttackTables();
   for (uint8_t i = 0; i < global.maxVoices(); i++) {
     global.Oscillators[i].filterEnvelope_.setEnvType(envTypeFilt);
   }
@@ -315,6 +348,7 @@ FLASHMEM void setUpSettings() {
   settings::append(settings::SettingsOption{"Amp. Env.", {"Lin", "Exp -8", "Exp -7", "Exp -6", "Exp -5", "Exp -4", "Exp -3", "Exp -2", "Exp -1", "Exp 0", "Exp +1", "Exp +2", "Exp +3", "Exp +4", "Exp +5", "Exp +6", "Exp +7", "Exp +8", "\0"}, settingsAmpEnv, currentIndexAmpEnv});
   settings::append(settings::SettingsOption{"Filter Env.", {"Lin", "Exp -8", "Exp -7", "Exp -6", "Exp -5", "Exp -4", "Exp -3", "Exp -2", "Exp -1", "Exp 0", "Exp +1", "Exp +2", "Exp +3", "Exp +4", "Exp +5", "Exp +6", "Exp +7", "Exp +8", "\0"}, settingsFiltEnv, currentIndexFiltEnv});
   settings::append(settings::SettingsOption{"Glide Shape", {"Lin", "Exp", "\0"}, settingsGlideShape, currentIndexGlideShape});
+  settings::append(settings::SettingsOption{"Quality", {"Eco", "Normal", "High", "\0"}, settingsQuality, currentIndexQuality});
   settings::append(settings::SettingsOption{"Pick-up", {"Off", "On", "\0"}, settingsPickupEnable, currentIndexPickupEnable});
   settings::append(settings::SettingsOption{"Encoder", {"Type 1", "Type 2", "\0"}, settingsEncoderDir, currentIndexEncoderDir});
   settings::append(settings::SettingsOption{"Oscilloscope", {"Off", "On", "\0"}, settingsScopeEnable, currentIndexScopeEnable});
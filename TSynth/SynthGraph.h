@@ -0,0 +1,288 @@
+#ifndef TSYNTH_SYNTH_GRAPH_H
+#define TSYNTH_SYNTH_GRAPH_H
+
+#include "AudioGraph.h"
+
+// The TSynth audio graph, see AudioGraph.h. Global declares the objects
+// group by group in this order:
+//
+//   noise  -->  modulation (per timbre)  -->  voices  -->  bus (per timbre)  -->  output
+//
+// and each struct in AudioPatching.h declares its objects in the order of
+// its node list and makes its fixed connections from the link tables here.
+// The voices are declared voice by voice, each Patch's nodes together.
+// Global checks that this numbering is an update order, so declared in it
+// no connection is received a block late, and Global::inUpdateOrder()
+// that the declarations follow it; setup() only uses the planned
+// AudioMemory() if they do.
+namespace SynthGraph {
+
+using AudioGraph::AUDIO;
+using AudioGraph::CONTROL;
+using AudioGraph::Edge;
+using AudioGraph::Node;
+using AudioGraph::FIRST_INPUT;
+using AudioGraph::ALL_INPUTS;
+
+static const uint8_t VOICES_PER_GROUP = 12;
+
+enum Group : uint8_t { NOISE, MODULATION, VOICE, BUS, OUTPUT };
+
+// Global, shared by every timbre
+enum NoiseNode : uint8_t { PINK, WHITE, NOISE_NODES };
+
+// PatchShared, one per timbre
+enum ModulationNode : uint8_t {
+    PITCH_BEND, PITCH_LFO, PITCH_MIXER, PWM_LFO_A, PWM_LFO_B, FILTER_LFO, PWA, PWB, NOISE_MIXER,
+    MODULATION_NODES
+};
+
+// Patch, one per voice
+enum VoiceNode : uint8_t {
+    FILTER_ENVELOPE, PW_MIXER_A, PW_MIXER_B, GLIDE, KEYTRACKING, OSC_MOD_MIXER_A, OSC_MOD_MIXER_B,
+    OSCILLATORS, WAVEFORM_MIXER, FILTER_MOD_MIXER, FILTER, LADDER, FILTER_MIXER, AMP_ENVELOPE,
+    VOICE_NODES
+};
+
+// PatchBus, one per timbre
+enum BusNode : uint8_t {
+    VOICE_MIXER, DC_OFFSET_FILTER, VOLUME_MIXER, ENSEMBLE, EFFECT_MIXER_L, EFFECT_MIXER_R,
+    BUS_NODES
+};
+
+// Global, after every timbre
+enum OutputNode : uint8_t {
+    OUTPUT_MIXER, PEAK, SCOPE, USB_AUDIO, I2S,
+    OUTPUT_NODES
+};
+
+// Node tables: name, instance (set as the graph is expanded), how the
+// object gets its output block and what it holds between updates. The
+// stock and TS mixers and the envelopes, DC blocker and filters work in
+// place, the oscillators, ensemble and summing buses release their inputs
+// before they allocate. The outputs each queue two blocks a channel for the DMA.
+static constexpr Node noiseNodes[NOISE_NODES] = {{"pink", 0}, {"white", 0}};
+static constexpr Node modulationNodes[MODULATION_NODES] = {
+    {"pitchBend", 0}, {"pitchLfo", 0}, {"pitchMixer", 0, FIRST_INPUT}, {"pwmLfoA", 0}, {"pwmLfoB", 0},
+    {"filterLfo", 0}, {"pwa", 0}, {"pwb", 0}, {"noiseMixer", 0, FIRST_INPUT}};
+static constexpr Node voiceNodes[VOICE_NODES] = {
+    {"filterEnvelope_", 0, 0}, {"pwMixer_a", 0, FIRST_INPUT}, {"pwMixer_b", 0, FIRST_INPUT}, {"glide_", 0},
+    {"keytracking_", 0}, {"oscModMixer_a", 0, FIRST_INPUT}, {"oscModMixer_b", 0, FIRST_INPUT},
+    {"oscillators_", 0, ALL_INPUTS}, {"waveformMixer_", 0, FIRST_INPUT}, {"filterModMixer_", 0, FIRST_INPUT},
+    {"filter_", 0, 0}, {"ladder_", 0, 0}, {"filterMixer_", 0, FIRST_INPUT}, {"ampEnvelope_", 0, 0}};
+static constexpr Node busNodes[BUS_NODES] = {
+    {"voiceMixer", 0, ALL_INPUTS}, {"dcOffsetFilter", 0, 0}, {"volumeMixer", 0, FIRST_INPUT},
+    {"ensemble", 0, ALL_INPUTS}, {"effectMixerL", 0, FIRST_INPUT}, {"effectMixerR", 0, FIRST_INPUT}};
+static constexpr Node outputNodes[OUTPUT_NODES] = {
+    {"outputMixer", 0, ALL_INPUTS}, {"peak", 0}, {"scope", 0},
+    {"usbAudio", 0, AudioGraph::NO_INPUT, 4}, {"i2s", 0, AudioGraph::NO_INPUT, 4}};
+
+// Blocks kept free on top of the plan: the filter's band and high pass
+// outputs, allocated but only read by the mixer behind whichever filter
+// is selected, and the odd block from a receiveWritable() that had to copy
+static const uint8_t AUDIO_MEMORY_MARGIN = 4;
+
+// Fixed connections inside each struct, made by its constructor
+static constexpr Edge modulationLinks[] = {
+    {PITCH_LFO, 0, PITCH_MIXER, 1, AUDIO},
+};
+
+static constexpr Edge voiceLinks[] = {
+    {PW_MIXER_A, 0, OSCILLATORS, 1, AUDIO},
+    {PW_MIXER_B, 0, OSCILLATORS, 3, AUDIO},
+    {OSCILLATORS, 0, WAVEFORM_MIXER, 0, AUDIO},
+    {FILTER_ENVELOPE, 0, FILTER_MOD_MIXER, 0, AUDIO},
+    {FILTER_ENVELOPE, 0, PW_MIXER_A, 2, AUDIO},
+    {FILTER_ENVELOPE, 0, PW_MIXER_B, 2, AUDIO},
+    {FILTER_MOD_MIXER, 0, FILTER, 1, AUDIO},
+    {FILTER_MOD_MIXER, 0, LADDER, 1, AUDIO},
+    // filter_ mixes LP/BP/HP itself, see VoiceGroup::setFilterMixer()
+    {FILTER, 0, FILTER_MIXER, 0, AUDIO},
+    {LADDER, 0, FILTER_MIXER, 1, AUDIO},
+    {FILTER_MIXER, 0, AMP_ENVELOPE, 0, AUDIO},
+    // Mod sources
+    {OSC_MOD_MIXER_A, 0, OSCILLATORS, 0, AUDIO},
+    {OSC_MOD_MIXER_B, 0, OSCILLATORS, 2, AUDIO},
+    // Pitch env
+    {FILTER_ENVELOPE, 0, OSC_MOD_MIXER_A, 1, AUDIO},
+    {FILTER_ENVELOPE, 0, OSC_MOD_MIXER_B, 1, AUDIO},
+};
+
+static constexpr Edge busLinks[] = {
+    {VOICE_MIXER, 0, DC_OFFSET_FILTER, 0, AUDIO},
+    {DC_OFFSET_FILTER, 0, VOLUME_MIXER, 0, AUDIO},
+    {VOLUME_MIXER, 0, ENSEMBLE, 0, AUDIO},
+    {ENSEMBLE, 0, EFFECT_MIXER_L, 1, AUDIO},
+    {ENSEMBLE, 1, EFFECT_MIXER_R, 1, AUDIO},
+    {VOLUME_MIXER, 0, EFFECT_MIXER_L, 0, AUDIO},
+    {VOLUME_MIXER, 0, EFFECT_MIXER_R, 0, AUDIO},
+};
+
+static constexpr Edge outputLinks[] = {
+    {OUTPUT_MIXER, 0, SCOPE, 0, AUDIO},
+    {OUTPUT_MIXER, 0, PEAK, 0, AUDIO},
+    {OUTPUT_MIXER, 1, USB_AUDIO, 1, AUDIO},
+    {OUTPUT_MIXER, 1, I2S, 1, AUDIO},
+    {OUTPUT_MIXER, 0, I2S, 0, AUDIO},
+    {OUTPUT_MIXER, 0, USB_AUDIO, 0, AUDIO},
+};
+
+// Connections between groups, or switched, made at run time. A link with
+// a stride goes to one of a summing bus's inputs by the voice's index in
+// its group, or the timbre's index: input + index * stride. 0 for the
+// others, the same input for every instance.
+struct Link {
+    Group srcGroup;
+    uint8_t src;
+    uint8_t output;
+    Group dstGroup;
+    uint8_t dst;
+    uint8_t input;
+    AudioGraph::EdgeKind kind;
+    uint8_t stride;
+};
+
+static constexpr Link runtimeLinks[] = {
+    // PatchShared::connectNoise()
+    {NOISE, PINK, 0, MODULATION, NOISE_MIXER, 0, AUDIO, 0},
+    {NOISE, WHITE, 0, MODULATION, NOISE_MIXER, 1, AUDIO, 0},
+    // Patch::connectTo()
+    {MODULATION, PITCH_MIXER, 0, VOICE, OSC_MOD_MIXER_A, 0, AUDIO, 0},
+    {MODULATION, PITCH_MIXER, 0, VOICE, OSC_MOD_MIXER_B, 0, AUDIO, 0},
+    {MODULATION, PWM_LFO_A, 0, VOICE, PW_MIXER_A, 0, AUDIO, 0},
+    {MODULATION, PWM_LFO_B, 0, VOICE, PW_MIXER_B, 0, AUDIO, 0},
+    {MODULATION, FILTER_LFO, 0, VOICE, FILTER_MOD_MIXER, 1, AUDIO, 0},
+    {MODULATION, NOISE_MIXER, 0, VOICE, WAVEFORM_MIXER, 2, AUDIO, 0},
+    {VOICE, AMP_ENVELOPE, 0, BUS, VOICE_MIXER, 0, AUDIO, 1},
+    // Patch::selectFilter(), only one is connected at a time but both are
+    // counted
+    {VOICE, WAVEFORM_MIXER, 0, VOICE, FILTER, 0, AUDIO, 0},
+    {VOICE, WAVEFORM_MIXER, 0, VOICE, LADDER, 0, AUDIO, 0},
+    // PatchBus::connectOutput()
+    {BUS, EFFECT_MIXER_L, 0, OUTPUT, OUTPUT_MIXER, 0, AUDIO, 2},
+    {BUS, EFFECT_MIXER_R, 0, OUTPUT, OUTPUT_MIXER, 1, AUDIO, 2},
+    // Control signals, see control_signal.h
+    {MODULATION, PITCH_BEND, 0, MODULATION, PITCH_MIXER, 0, CONTROL, 0},
+    {MODULATION, PWA, 0, VOICE, PW_MIXER_A, 1, CONTROL, 0},
+    {MODULATION, PWB, 0, VOICE, PW_MIXER_B, 1, CONTROL, 0},
+    {VOICE, KEYTRACKING, 0, VOICE, FILTER_MOD_MIXER, 2, CONTROL, 0},
+    {VOICE, GLIDE, 0, VOICE, OSC_MOD_MIXER_A, 2, CONTROL, 0},
+    {VOICE, GLIDE, 0, VOICE, OSC_MOD_MIXER_B, 2, CONTROL, 0},
+};
+
+template <class T, size_t N>
+constexpr size_t count(const T (&)[N])
+{
+    return N;
+}
+
+// The whole graph for TIMBRES timbres and VOICES voices, the voices
+// filling each timbre's group in turn as setup() adds them
+template <uint8_t TIMBRES, uint8_t VOICES>
+struct Config {
+    static_assert(VOICES <= TIMBRES * VOICES_PER_GROUP, "more voices than the voice buses take");
+
+    static constexpr size_t NODES =
+        NOISE_NODES + TIMBRES * (MODULATION_NODES + BUS_NODES) + VOICES * VOICE_NODES + OUTPUT_NODES;
+
+    // Instances of a link: one per voice if it touches a voice, per timbre
+    // if it touches a timbre's objects, otherwise one
+    static constexpr size_t instances(const Link &l)
+    {
+        return l.srcGroup == VOICE || l.dstGroup == VOICE ? VOICES
+            : l.srcGroup == MODULATION || l.srcGroup == BUS || l.dstGroup == MODULATION || l.dstGroup == BUS ? TIMBRES
+            : 1;
+    }
+
+    static constexpr size_t runtimeEdges()
+    {
+        size_t n = 0;
+        for (size_t i = 0; i < count(runtimeLinks); i++) n += instances(runtimeLinks[i]);
+        return n;
+    }
+
+    static constexpr size_t EDGES = TIMBRES * (count(modulationLinks) + count(busLinks)) +
+        VOICES * count(voiceLinks) + count(outputLinks) + runtimeEdges();
+
+    static constexpr uint16_t firstNode(Group group, uint8_t instance)
+    {
+        return group == NOISE ? 0
+            : group == MODULATION ? NOISE_NODES + instance * MODULATION_NODES
+            : group == VOICE ? NOISE_NODES + TIMBRES * MODULATION_NODES + instance * VOICE_NODES
+            : group == BUS ? NOISE_NODES + TIMBRES * MODULATION_NODES + VOICES * VOICE_NODES + instance * BUS_NODES
+            : NOISE_NODES + TIMBRES * (MODULATION_NODES + BUS_NODES) + VOICES * VOICE_NODES;
+    }
+
+    // Node id of instance's group, in the graph
+    static constexpr uint16_t nodeIndex(Group group, uint8_t instance, uint8_t id)
+    {
+        return firstNode(group, instance) + id;
+    }
+
+    static constexpr Edge offset(const Edge &e, Group group, uint8_t instance)
+    {
+        return Edge{nodeIndex(group, instance, e.src), e.output, nodeIndex(group, instance, e.dst), e.input, e.kind};
+    }
+
+    static constexpr Node instance(const Node &node, uint8_t i)
+    {
+        return Node{node.name, i, node.inPlace, node.held};
+    }
+
+    static constexpr AudioGraph::Graph<NODES, EDGES> graph()
+    {
+        AudioGraph::Graph<NODES, EDGES> g{};
+        size_t n = 0, e = 0;
+        for (uint8_t i = 0; i < NOISE_NODES; i++) g.nodes[n++] = noiseNodes[i];
+        for (uint8_t t = 0; t < TIMBRES; t++) {
+            for (uint8_t i = 0; i < MODULATION_NODES; i++) g.nodes[n++] = instance(modulationNodes[i], t);
+        }
+        for (uint8_t v = 0; v < VOICES; v++) {
+            for (uint8_t i = 0; i < VOICE_NODES; i++) g.nodes[n++] = instance(voiceNodes[i], v);
+        }
+        for (uint8_t t = 0; t < TIMBRES; t++) {
+            for (uint8_t i = 0; i < BUS_NODES; i++) g.nodes[n++] = instance(busNodes[i], t);
+        }
+        for (uint8_t i = 0; i < OUTPUT_NODES; i++) g.nodes[n++] = outputNodes[i];
+
+        for (uint8_t t = 0; t < TIMBRES; t++) {
+            for (size_t i = 0; i < count(modulationLinks); i++) g.edges[e++] = offset(modulationLinks[i], MODULATION, t);
+            for (size_t i = 0; i < count(busLinks); i++) g.edges[e++] = offset(busLinks[i], BUS, t);
+        }
+        for (uint8_t v = 0; v < VOICES; v++) {
+            for (size_t i = 0; i < count(voiceLinks); i++) g.edges[e++] = offset(voiceLinks[i], VOICE, v);
+        }
+        for (size_t i = 0; i < count(outputLinks); i++) g.edges[e++] = offset(outputLinks[i], OUTPUT, 0);
+
+        for (size_t i = 0; i < count(runtimeLinks); i++) {
+            const Link &l = runtimeLinks[i];
+            const bool perVoice = l.srcGroup == VOICE || l.dstGroup == VOICE;
+            for (uint8_t k = 0; k < instances(l); k++) {
+                const uint8_t timbre = perVoice ? k / VOICES_PER_GROUP : k;
+                const uint8_t index = perVoice ? k % VOICES_PER_GROUP : k;
+                const uint8_t src = l.srcGroup == VOICE ? k : timbre;
+                const uint8_t dst = l.dstGroup == VOICE ? k : timbre;
+                Edge edge{nodeIndex(l.srcGroup, src, l.src), l.output, nodeIndex(l.dstGroup, dst, l.dst), l.input, l.kind};
+                edge.input += index * l.stride;
+                g.edges[e++] = edge;
+            }
+        }
+        return g;
+    }
+
+    static constexpr AudioGraph::Schedule<NODES, EDGES> schedule()
+    {
+        return AudioGraph::compile(graph());
+    }
+
+    // Blocks for AudioMemory(): the peak the schedule holds at once, the
+    // blocks held inside objects and the margin
+    static constexpr uint16_t audioMemory()
+    {
+        return schedule().blocks + schedule().held + AUDIO_MEMORY_MARGIN;
+    }
+};
+
+}
+
+#endif
@@ -64,6 +64,8 @@
 #include "utils.h"
 #include "Voice.h"
 #include "VoiceGroup.h"
+#include "Quality.h"
+#include "HeapMonitor.h"
 
 #define PARAMETER 0     // The main page for displaying the current patch and control (parameter) changes
 #define RECALL 1        // Patches list
@@ -79,11 +81,14 @@
 
 uint32_t state = PARAMETER;
 
-// Initialize the audio configuration.
+// Initialize the audio configuration. A static, so the audio objects and
+// their buffers are in DTCM, see memory_placement.h
 Global global{VOICEMIXERLEVEL};
 // VoiceGroup voices1{global.SharedAudio[0]};
 std::vector<VoiceGroup *> groupvec;
 uint8_t activeGroupIndex = 0;
+// The quality level in Settings and the one the voices are playing at
+QualityGovernor qualityGovernor;
 
 #include "ST7735Display.h"
 
@@ -102,6 +107,12 @@ void changeMIDIThruMode()
   MIDI.turnThruOn(MIDIThru);
 }
 
+void applyQuality()
+{
+  for (VoiceGroup *group : groupvec)
+    group->setQuality(qualityGovernor.level());
+}
+
 #include "Settings.h"
 
 boolean cardStatus = false;
@@ -111,6 +122,7 @@ float previousMillis = millis(); // For MIDI Clk Sync
 
 uint8_t count = 0;           // For MIDI Clk Sync
 uint16_t patchNo = 1;         // Current patch no
+uint16_t audioMemoryBlocks = Global::AUDIO_MEMORY_BLOCKS; // Audio block pool, see setup()
 long earliestTime = millis(); // For voice allocation - initialise to now
 
 
@@ -167,7 +179,7 @@ int getLFOWaveform(int value)
   }
 }
 
-FLASHMEM String getWaveformStr(uint32_t value)
+FLASHMEM const __FlashStringHelper *getWaveformStr(uint32_t value)
 {
   switch (value)
   {
@@ -195,6 +207,8 @@ FLASHMEM String getWaveformStr(uint32_t value)
     return F("Parabolic");
   case WAVEFORM_HARMONIC:
     return F("Harmonic");
+  case WAVEFORM_SUPERSAW:
+    return F("Supersaw");
   default:
     return F("ERR_WAVE");
   }
@@ -252,14 +266,14 @@ FLASHMEM void updatePitchA(int pitch)
 {
   groupvec[activeGroupIndex]->params().oscPitchA = pitch;
   groupvec[activeGroupIndex]->updateVoices();
-  showCurrentParameterPage("1. Semitones", (pitch > 0 ? "+" : "") + String(pitch));
+  showCurrentParameterPage(F("1. Semitones"), text(pitch > 0 ? "+" : "", pitch));
 }
 
 FLASHMEM void updatePitchB(int pitch)
 {
   groupvec[activeGroupIndex]->params().oscPitchB = pitch;
   groupvec[activeGroupIndex]->updateVoices();
-  showCurrentParameterPage(F("2. Semitones"), (pitch > 0 ? "+" : "") + String(pitch));
+  showCurrentParameterPage(F("2. Semitones"), text(pitch > 0 ? "+" : "", pitch));
 }
 
 FLASHMEM void updateDetune(float detune, uint32_t chordDetune)
@@ -274,7 +288,7 @@ FLASHMEM void updateDetune(float detune, uint32_t chordDetune)
   }
   else
   {
-    showCurrentParameterPage(F("Detune"), String((1 - detune) * 100) + F(" %"));
+    showCurrentParameterPage(F("Detune"), text((1 - detune) * 100, F(" %")));
   }
 }
 
@@ -308,7 +322,7 @@ FLASHMEM void updatePWMRate(float value)
   }
   else
   {
-    showCurrentParameterPage(F("PWM Rate"), String(2 * value) + F(" Hz")); // PWM goes through mid to maximum, sounding effectively twice as fast
+    showCurrentParameterPage(F("PWM Rate"), text(2 * value, F(" Hz"))); // PWM goes through mid to maximum, sounding effectively twice as fast
   }
 }
 
@@ -316,7 +330,7 @@ FLASHMEM void updatePWMAmount(float value)
 {
   // MIDI only - sets both osc PWM
   groupvec[activeGroupIndex]->overridePwmAmount(value);
-  showCurrentParameterPage(F("PWM Amt"), String(value) + F(" : ") + String(value));
+  showCurrentParameterPage(F("PWM Amt"), text(value, F(" : "), value));
 }
 
 FLASHMEM void updatePWA(float valuePwA, float valuePwmAmtA)
@@ -339,12 +353,12 @@ FLASHMEM void updatePWA(float valuePwA, float valuePwmAmtA)
     if (groupvec[activeGroupIndex]->getPwmSource() == PWMSOURCELFO)
     {
       // PW alters PWM LFO amount for waveform A
-      showCurrentParameterPage(F("1. PWM Amt"), F("LFO ") + String(groupvec[activeGroupIndex]->getPwmAmtA()));
+      showCurrentParameterPage(F("1. PWM Amt"), text(F("LFO "), groupvec[activeGroupIndex]->getPwmAmtA()));
     }
     else
     {
       // PW alters PWM Filter Env amount for waveform A
-      showCurrentParameterPage(F("1. PWM Amt"), F("F. Env ") + String(groupvec[activeGroupIndex]->getPwmAmtA()));
+      showCurrentParameterPage(F("1. PWM Amt"), text(F("F. Env "), groupvec[activeGroupIndex]->getPwmAmtA()));
     }
   }
 }
@@ -369,12 +383,12 @@ FLASHMEM void updatePWB(float valuePwB, float valuePwmAmtB)
     if (groupvec[activeGroupIndex]->getPwmSource() == PWMSOURCELFO)
     {
       // PW alters PWM LFO amount for waveform B
-      showCurrentParameterPage(F("2. PWM Amt"), F("LFO ") + String(groupvec[activeGroupIndex]->getPwmAmtB()));
+      showCurrentParameterPage(F("2. PWM Amt"), text(F("LFO "), groupvec[activeGroupIndex]->getPwmAmtB()));
     }
     else
     {
       // PW alters PWM Filter Env amount for waveform B
-      showCurrentParameterPage(F("2. PWM Amt"), F("F. Env ") + String(groupvec[activeGroupIndex]->getPwmAmtB()));
+      showCurrentParameterPage(F("2. PWM Amt"), text(F("F. Env "), groupvec[activeGroupIndex]->getPwmAmtB()));
     }
   }
 }
@@ -386,17 +400,18 @@ FLASHMEM void updateOscLevelA(float value)
   switch (groupvec[activeGroupIndex]->getOscFX())
   {
   case 1: // XOR
-    showCurrentParameterPage(F("Osc Mix 1:2"), F("   ") + String(groupvec[activeGroupIndex]->getOscLevelA()) + F(" : ") + String(groupvec[activeGroupIndex]->getOscLevelB()));
+    showCurrentParameterPage(F("Osc Mix 1:2"), text(F("   "), groupvec[activeGroupIndex]->getOscLevelA(), F(" : "), groupvec[activeGroupIndex]->getOscLevelB()));
     break;
   case 2: // XMod
     // osc A sounds with increasing osc B mod
     if (groupvec[activeGroupIndex]->getOscLevelA() == 1.0f && groupvec[activeGroupIndex]->getOscLevelB() <= 1.0f)
     {
-      showCurrentParameterPage(F("XMod Osc 1"), F("Osc 2: ") + String(1 - groupvec[activeGroupIndex]->getOscLevelB()));
+      showCurrentParameterPage(F("XMod Osc 1"), text(F("Osc 2: "), 1 - groupvec[activeGroupIndex]->getOscLevelB()));
     }
     break;
   case 0: // None
-    showCurrentParameterPage(F("Osc Mix 1:2"), F("   ") + String(groupvec[activeGroupIndex]->getOscLevelA()) + F(" : ") + String(groupvec[activeGroupIndex]->getOscLevelB()));
+  case 3: // Sync
+    showCurrentParameterPage(F("Osc Mix 1:2"), text(F("   "), groupvec[activeGroupIndex]->getOscLevelA(), F(" : "), groupvec[activeGroupIndex]->getOscLevelB()));
     break;
   }
 }
@@ -408,17 +423,18 @@ FLASHMEM void updateOscLevelB(float value)
   switch (groupvec[activeGroupIndex]->getOscFX())
   {
   case 1: // XOR
-    showCurrentParameterPage(F("Osc Mix 1:2"), F("   ") + String(groupvec[activeGroupIndex]->getOscLevelA()) + F(" : ") + String(groupvec[activeGroupIndex]->getOscLevelB()));
+    showCurrentParameterPage(F("Osc Mix 1:2"), text(F("   "), groupvec[activeGroupIndex]->getOscLevelA(), F(" : "), groupvec[activeGroupIndex]->getOscLevelB()));
     break;
   case 2: // XMod
     // osc B sounds with increasing osc A mod
     if (groupvec[activeGroupIndex]->getOscLevelB() == 1.0f && groupvec[activeGroupIndex]->getOscLevelA() < 1.0f)
     {
-      showCurrentParameterPage(F("XMod Osc 2"), F("Osc 1: ") + String(1 - groupvec[activeGroupIndex]->getOscLevelA()));
+      showCurrentParameterPage(F("XMod Osc 2"), text(F("Osc 1: "), 1 - groupvec[activeGroupIndex]->getOscLevelA()));
     }
     break;
   case 0: // None
-    showCurrentParameterPage(F("Osc Mix 1:2"), F("   ") + String(groupvec[activeGroupIndex]->getOscLevelA()) + F(" : ") + String(groupvec[activeGroupIndex]->getOscLevelB()));
+  case 3: // Sync
+    showCurrentParameterPage(F("Osc Mix 1:2"), text(F("   "), groupvec[activeGroupIndex]->getOscLevelA(), F(" : "), groupvec[activeGroupIndex]->getOscLevelB()));
     break;
   }
 }
@@ -441,11 +457,11 @@ FLASHMEM void updateNoiseLevel(float value)
 
   if (value > 0)
   {
-    showCurrentParameterPage(F("Noise Level"), F("Pink ") + String(pink));
+    showCurrentParameterPage(F("Noise Level"), text(F("Pink "), pink));
   }
   else if (value < 0)
   {
-    showCurrentParameterPage(F("Noise Level"), F("White ") + String(white));
+    showCurrentParameterPage(F("Noise Level"), text(F("White "), white));
   }
   else
   {
@@ -456,7 +472,7 @@ FLASHMEM void updateNoiseLevel(float value)
 FLASHMEM void updateFilterFreq(float value)
 {
   groupvec[activeGroupIndex]->setCutoff(value);
-  showCurrentParameterPage(F("Cutoff"), String(int(value)) + F(" Hz"));
+  showCurrentParameterPage(F("Cutoff"), text(int(value), F(" Hz")));
 }
 
 FLASHMEM void updateFilterRes(float value)
@@ -469,47 +485,79 @@ FLASHMEM void updateFilterMixer(float value)
 {
   groupvec[activeGroupIndex]->setFilterMixer(value);
 
-  String filterStr;
+  TextBuffer<DISPLAY_CHARS> filterStr;
   if (value == BANDPASS)
   {
-    filterStr = F("Band Pass");
+    filterStr.set(F("Band Pass"));
   }
   else
   {
     // LP-HP mix mode - a notch filter
     if (value == LOWPASS)
     {
-      filterStr = F("Low Pass");
+      filterStr.set(F("Low Pass"));
     }
     else if (value == HIGHPASS)
     {
-      filterStr = F("High Pass");
+      filterStr.set(F("High Pass"));
     }
     else
     {
-      filterStr = F("LP ") + String(100 - int(100 * value)) + F(" - ") + String(int(100 * value)) + F(" HP");
+      filterStr.set(F("LP "), 100 - int(100 * value), F(" - "), int(100 * value), F(" HP"));
     }
   }
 
   showCurrentParameterPage(F("Filter Type"), filterStr);
 }
 
+FLASHMEM void updateFilterType(uint8_t type)
+{
+  groupvec[activeGroupIndex]->setFilterType(type);
+
+  if (type == FILTERTYPELADDER)
+  {
+    showCurrentParameterPage(F("Filter Model"), F("Ladder 24dB")); // Only shown when updated via MIDI
+  }
+  else
+  {
+    showCurrentParameterPage(F("Filter Model"), F("State Var 12dB"));
+  }
+}
+
+// Samples between cutoff calculations in the state variable filter, saved
+// with the patch
+FLASHMEM void updateFilterControlRate(uint8_t samples)
+{
+  groupvec[activeGroupIndex]->setFilterControlRate(samples);
+
+  TextBuffer<DISPLAY_CHARS> rateStr;
+  if (samples <= 1)
+  {
+    rateStr.set(F("Every sample"));
+  }
+  else
+  {
+    rateStr.set(F("Every "), (int)samples, F(" samples"));
+  }
+  showCurrentParameterPage(F("Filter Ctrl Rate"), rateStr); // Only shown when updated via MIDI
+}
+
 FLASHMEM void updateFilterEnv(float value)
 {
   groupvec[activeGroupIndex]->setFilterEnvelope(value);
-  showCurrentParameterPage(F("Filter Env."), String(value));
+  showCurrentParameterPage(F("Filter Env."), value);
 }
 
 FLASHMEM void updatePitchEnv(float value)
 {
   groupvec[activeGroupIndex]->setPitchEnvelope(value);
-  showCurrentParameterPage(F("Pitch Env Amt"), String(value));
+  showCurrentParameterPage(F("Pitch Env Amt"), value);
 }
 
 FLASHMEM void updateKeyTracking(float value)
 {
   groupvec[activeGroupIndex]->setKeytracking(value);
-  showCurrentParameterPage(F("Key Tracking"), String(value));
+  showCurrentParameterPage(F("Key Tracking"), value);
 }
 
 FLASHMEM void updatePitchLFOAmt(float value)
@@ -527,7 +575,7 @@ FLASHMEM void updateModWheel(float value)
 FLASHMEM void updatePitchLFORate(float value)
 {
   groupvec[activeGroupIndex]->setPitchLfoRate(value);
-  showCurrentParameterPage(F("LFO Rate"), String(value) + F(" Hz"));
+  showCurrentParameterPage(F("LFO Rate"), text(value, F(" Hz")));
 }
 
 FLASHMEM void updatePitchLFOWaveform(uint32_t waveform)
@@ -543,24 +591,24 @@ FLASHMEM void updatePitchLFOMidiClkSync(bool value)
   showCurrentParameterPage(F("P. LFO Sync"), value ? F("On") : F("Off"));
 }
 
-FLASHMEM void updateFilterLfoRate(float value, String timeDivStr)
+FLASHMEM void updateFilterLfoRate(float value, const char *timeDivStr)
 {
   groupvec[activeGroupIndex]->setFilterLfoRate(value);
 
-  if (timeDivStr.length() > 0)
+  if (timeDivStr)
   {
     showCurrentParameterPage(F("LFO Time Div"), timeDivStr);
   }
   else
   {
-    showCurrentParameterPage(F("F. LFO Rate"), String(value) + F(" Hz"));
+    showCurrentParameterPage(F("F. LFO Rate"), text(value, F(" Hz")));
   }
 }
 
 FLASHMEM void updateFilterLfoAmt(float value)
 {
   groupvec[activeGroupIndex]->setFilterLfoAmt(value);
-  showCurrentParameterPage(F("F. LFO Amt"), String(value));
+  showCurrentParameterPage(F("F. LFO Amt"), value);
 }
 
 FLASHMEM void updateFilterLFOWaveform(uint32_t waveform)
@@ -598,13 +646,13 @@ FLASHMEM void updateFilterAttack(float value)
 FLASHMEM void updateFilterDecay(float value)
 {
   groupvec[activeGroupIndex]->setFilterDecay(value);
-  showCurrentParameterPage("Filter Decay", milliToString(value), FILTER_ENV);
+  showCurrentParameterPage(F("Filter Decay"), milliToString(value), FILTER_ENV);
 }
 
 FLASHMEM void updateFilterSustain(float value)
 {
   groupvec[activeGroupIndex]->setFilterSustain(value);
-  showCurrentParameterPage(F("Filter Sustain"), String(value), FILTER_ENV);
+  showCurrentParameterPage(F("Filter Sustain"), value, FILTER_ENV);
 }
 
 FLASHMEM void updateFilterRelease(float value)
@@ -628,7 +676,7 @@ FLASHMEM void updateDecay(float value)
 FLASHMEM void updateSustain(float value)
 {
   groupvec[activeGroupIndex]->setAmpSustain(value);
-  showCurrentParameterPage(F("Sustain"), String(value), AMP_ENV);
+  showCurrentParameterPage(F("Sustain"), value, AMP_ENV);
 }
 
 FLASHMEM void updateRelease(float value)
@@ -646,6 +694,10 @@ FLASHMEM void updateOscFX(uint8_t value)
 //    analogWriteFrequency(OSC_FX_LED, 1); // This is to make the LED flash using PWM rather than some thread
 //    analogWrite(OSC_FX_LED, 127);
   }
+  else if (value == 3)
+  {
+    showCurrentParameterPage(F("Osc FX"), F("On - Sync"));
+  }
   else if (value == 1)
   {
     showCurrentParameterPage(F("Osc FX"), F("On - XOR"));
@@ -663,20 +715,20 @@ FLASHMEM void updateOscFX(uint8_t value)
 FLASHMEM void updateEffectAmt(float value)
 {
   groupvec[activeGroupIndex]->setEffectAmount(value);
-  showCurrentParameterPage(F("Effect Amt"), String(value) + F(" Hz"));
+  showCurrentParameterPage(F("Effect Amt"), text(value, F(" Hz")));
 }
 
 FLASHMEM void updateEffectMix(float value)
 {
   groupvec[activeGroupIndex]->setEffectMix(value);
-  showCurrentParameterPage(F("Effect Mix"), String(value));
+  showCurrentParameterPage(F("Effect Mix"), value);
 }
 
 FLASHMEM void updatePatch(String name, uint32_t index)
 {
   groupvec[activeGroupIndex]->setPatchName(name);
   groupvec[activeGroupIndex]->setPatchIndex(index);
-  showPatchPage(String(index), name);
+  showPatchPage(index, name);
 }
 
 void myPitchBend(byte channel, int bend)
@@ -728,6 +780,15 @@ void myControlChange(byte channel, byte control, byte value)
     updatePWMSource(value > 0 ? PWMSOURCEFENV : PWMSOURCELFO);
     break;
 
+  case CCfiltertype:
+    updateFilterType(value > 0 ? FILTERTYPELADDER : FILTERTYPESVF);
+    break;
+
+  case CCfiltercontrolrate:
+    // Seven steps, 1 to 64 samples
+    updateFilterControlRate(1 << (value * 7 / 128));
+    break;
+
   case CCpwmRate:
     // Uses combination of PWMRate, PWa and PWb
     updatePWMRate(PWMRATE[value]);
@@ -852,7 +913,7 @@ void myControlChange(byte channel, byte control, byte value)
       return; // PICK-UP
 
     float rate;
-    String timeDivStr = "";
+    const char *timeDivStr = nullptr;
     if (groupvec[activeGroupIndex]->getFilterLfoMidiClockSync())
     {
       lfoTempoValue = LFOTEMPO[value];
@@ -924,7 +985,7 @@ void myControlChange(byte channel, byte control, byte value)
     break;
 
   case CCoscfx:
-    updateOscFX(inRangeOrDefault<int>(value, 2, 0, 2));
+    updateOscFX(inRangeOrDefault<int>(value, 3, 0, 3));
     break;
 
   case CCfxamt:
@@ -1001,13 +1062,85 @@ void showSettingsPage()
   showSettingsPage(settings::current_setting(), settings::current_setting_value(), state);
 }
 
-FLASHMEM String getCurrentPatchData()
-{
-    auto p = groupvec[activeGroupIndex]->params();
-    return patchName + F(",") + String(groupvec[activeGroupIndex]->getOscLevelA()) + F(",") + String(groupvec[activeGroupIndex]->getOscLevelB()) + F(",") + String(groupvec[activeGroupIndex]->getPinkNoiseLevel() - groupvec[activeGroupIndex]->getWhiteNoiseLevel()) + F(",") + String(p.unisonMode) + F(",") + String(groupvec[activeGroupIndex]->getOscFX()) + F(",") + String(p.detune, 5) + F(",") + String(lfoSyncFreq) + F(",") + String(midiClkTimeInterval) + F(",") + String(lfoTempoValue) + F(",") + String(groupvec[activeGroupIndex]->getKeytrackingAmount()) + F(",") + String(p.glideSpeed, 5) + F(",") + String(p.oscPitchA) + F(",") + String(p.oscPitchB) + F(",") + String(groupvec[activeGroupIndex]->getWaveformA()) + F(",") + String(groupvec[activeGroupIndex]->getWaveformB()) + F(",") +
-           String(groupvec[activeGroupIndex]->getPwmSource()) + F(",") + String(groupvec[activeGroupIndex]->getPwmAmtA()) + F(",") + String(groupvec[activeGroupIndex]->getPwmAmtB()) + F(",") + String(groupvec[activeGroupIndex]->getPwmRate()) + F(",") + String(groupvec[activeGroupIndex]->getPwA()) + F(",") + String(groupvec[activeGroupIndex]->getPwB()) + F(",") + String(groupvec[activeGroupIndex]->getResonance()) + F(",") + String(groupvec[activeGroupIndex]->getCutoff()) + F(",") + String(groupvec[activeGroupIndex]->getFilterMixer()) + F(",") + String(groupvec[activeGroupIndex]->getFilterEnvelope()) + F(",") + String(groupvec[activeGroupIndex]->getPitchLfoAmount(), 5) + F(",") + String(groupvec[activeGroupIndex]->getPitchLfoRate(), 5) + F(",") + String(groupvec[activeGroupIndex]->getPitchLfoWaveform()) + F(",") + String(int(groupvec[activeGroupIndex]->getPitchLfoRetrig())) + F(",") + String(int(groupvec[activeGroupIndex]->getPitchLfoMidiClockSync())) + F(",") + String(groupvec[activeGroupIndex]->getFilterLfoRate(), 5) + F(",") +
-           groupvec[activeGroupIndex]->getFilterLfoRetrig() + F(",") + groupvec[activeGroupIndex]->getFilterLfoMidiClockSync() + F(",") + groupvec[activeGroupIndex]->getFilterLfoAmt() + F(",") + groupvec[activeGroupIndex]->getFilterLfoWaveform() + F(",") + groupvec[activeGroupIndex]->getFilterAttack() + F(",") + groupvec[activeGroupIndex]->getFilterDecay() + F(",") + groupvec[activeGroupIndex]->getFilterSustain() + F(",") + groupvec[activeGroupIndex]->getFilterRelease() + F(",") + groupvec[activeGroupIndex]->getAmpAttack() + F(",") + groupvec[activeGroupIndex]->getAmpDecay() + F(",") + groupvec[activeGroupIndex]->getAmpSustain() + F(",") + groupvec[activeGroupIndex]->getAmpRelease() + F(",") +
-           String(groupvec[activeGroupIndex]->getEffectAmount()) + F(",") + String(groupvec[activeGroupIndex]->getEffectMix()) + F(",") + String(groupvec[activeGroupIndex]->getPitchEnvelope()) + F(",") + String(velocitySens) + F(",") + String(p.chordDetune) + F(",") + String(groupvec[activeGroupIndex]->getMonophonicMode()) + F(",") + String(0.0f) + F(",") + String(0.0f);
+// One field of the patch file, after a comma. Floats to 2 places unless
+// given, as String() wrote them.
+template <class T>
+void patchField(Print &out, T value)
+{
+    out.print(',');
+    out.print(value);
+}
+
+void patchField(Print &out, float value, int digits)
+{
+    out.print(',');
+    out.print(value, digits);
+}
+
+FLASHMEM void getCurrentPatchData(Print &out)
+{
+    VoiceGroup &g = *groupvec[activeGroupIndex];
+    auto p = g.params();
+    out.print(patchName);
+    patchField(out, g.getOscLevelA());
+    patchField(out, g.getOscLevelB());
+    patchField(out, g.getPinkNoiseLevel() - g.getWhiteNoiseLevel());
+    patchField(out, p.unisonMode);
+    patchField(out, g.getOscFX());
+    patchField(out, p.detune, 5);
+    patchField(out, lfoSyncFreq);
+    patchField(out, midiClkTimeInterval);
+    patchField(out, lfoTempoValue);
+    patchField(out, g.getKeytrackingAmount());
+    patchField(out, p.glideSpeed, 5);
+    patchField(out, p.oscPitchA);
+    patchField(out, p.oscPitchB);
+    patchField(out, g.getWaveformA());
+    patchField(out, g.getWaveformB());
+    patchField(out, g.getPwmSource());
+    patchField(out, g.getPwmAmtA());
+    patchField(out, g.getPwmAmtB());
+    patchField(out, g.getPwmRate());
+    patchField(out, g.getPwA());
+    patchField(out, g.getPwB());
+    patchField(out, g.getResonance());
+    patchField(out, g.getCutoff());
+    patchField(out, g.getFilterMixer());
+    patchField(out, g.getFilterEnvelope());
+    patchField(out, g.getPitchLfoAmount(), 5);
+    patchField(out, g.getPitchLfoRate(), 5);
+    patchField(out, g.getPitchLfoWaveform());
+    patchField(out, int(g.getPitchLfoRetrig()));
+    patchField(out, int(g.getPitchLfoMidiClockSync()));
+    patchField(out, g.getFilterLfoRate(), 5);
+    patchField(out, int(g.getFilterLfoRetrig()));
+    patchField(out, int(g.getFilterLfoMidiClockSync()));
+    patchField(out, g.getFilterLfoAmt());
+    patchField(out, g.getFilterLfoWaveform());
+    patchField(out, g.getFilterAttack());
+    patchField(out, g.getFilterDecay());
+    patchField(out, g.getFilterSustain());
+    patchField(out, g.getFilterRelease());
+    patchField(out, g.getAmpAttack());
+    patchField(out, g.getAmpDecay());
+    patchField(out, g.getAmpSustain());
+    patchField(out, g.getAmpRelease());
+    patchField(out, g.getEffectAmount());
+    patchField(out, g.getEffectMix());
+    patchField(out, g.getPitchEnvelope());
+    patchField(out, velocitySens);
+    patchField(out, p.chordDetune);
+    patchField(out, g.getMonophonicMode());
+    patchField(out, g.getFilterControlRate());
+    patchField(out, g.getFilterType());
+}
+
+// Saves the current patch, the data built in a fixed buffer
+FLASHMEM void saveCurrentPatch(int no)
+{
+    TextBuffer<PATCH_DATA_CHARS> data;
+    getCurrentPatchData(data);
+    savePatch(text(no), data);
 }
 
 FLASHMEM void reinitialiseToPanel()
@@ -1083,8 +1216,10 @@ FLASHMEM void setCurrentPatchData(String data[])
     updatePitchEnv(data[46].toFloat());
     velocitySens = data[47].toFloat();
     groupvec[activeGroupIndex]->setMonophonic(data[49].toInt());
-    //  SPARE1 = data[50].toFloat();
-    //  SPARE2 = data[51].toFloat();
+    // Was SPARE1, older patches hold 0 which means every sample
+    groupvec[activeGroupIndex]->setFilterControlRate(data[50].toInt());
+    // Was SPARE2, older patches hold 0.00 which is the state variable filter
+    updateFilterType(data[51].toInt());
 
     Serial.print(F("Set Patch: "));
     Serial.println(data[0]);
@@ -1095,7 +1230,7 @@ FLASHMEM void recallPatch(int patchNo)
 {
     groupvec[activeGroupIndex]->allNotesOff();
     groupvec[activeGroupIndex]->closeEnvelopes();
-    File patchFile = SD.open(String(patchNo).c_str());
+    File patchFile = SD.open(text(patchNo));
     if (!patchFile)
     {
         Serial.println(F("File not found"));
@@ -1139,24 +1274,24 @@ void checkSwitches()
       // Save as new patch with INITIALPATCH name or overwrite existing keeping name - bypassing patch renaming
       patchName = patches.last().patchName;
       state = PATCH;
-      savePatch(String(patches.last().patchNo).c_str(), getCurrentPatchData());
+      saveCurrentPatch(patches.last().patchNo);
       showPatchPage(patches.last().patchNo, patches.last().patchName);
       patchNo = patches.last().patchNo;
       loadPatches(); // Get rid of pushed patch if it wasn't saved
       setPatchesOrdering(patchNo);
-      renamedPatch = "";
+      renamedPatch.clear();
       state = PARAMETER;
       break;
     case PATCHNAMING:
       if (renamedPatch.length() > 0)
-        patchName = renamedPatch; // Prevent empty strings
+        patchName = renamedPatch.c_str(); // Prevent empty strings
       state = PATCH;
-      savePatch(String(patches.last().patchNo).c_str(), getCurrentPatchData());
+      saveCurrentPatch(patches.last().patchNo);
       showPatchPage(patches.last().patchNo, patchName);
       patchNo = patches.last().patchNo;
       loadPatches(); // Get rid of pushed patch if it wasn't saved
       setPatchesOrdering(patchNo);
-      renamedPatch = "";
+      renamedPatch.clear();
       state = PARAMETER;
       break;
     }
@@ -1204,14 +1339,14 @@ void checkSwitches()
       state = PARAMETER;
       break;
     case SAVE:
-      renamedPatch = "";
+      renamedPatch.clear();
       state = PARAMETER;
       loadPatches(); // Remove patch that was to be saved
       setPatchesOrdering(patchNo);
       break;
     case PATCHNAMING:
       charIndex = 0;
-      renamedPatch = "";
+      renamedPatch.clear();
       state = SAVE;
       break;
     case DELETE:
@@ -1260,9 +1395,9 @@ void checkSwitches()
       state = PATCHNAMING;
       break;
     case PATCHNAMING:
-      if (renamedPatch.length() < 12) // actually 12 chars
+      if (renamedPatch.length() < PATCHNAMECHARS)
       {
-        renamedPatch.concat(String(currentCharacter));
+        renamedPatch.print(currentCharacter);
         charIndex = 0;
         currentCharacter = CHARACTERS[charIndex];
         showRenamingPage(renamedPatch);
@@ -1275,7 +1410,7 @@ void checkSwitches()
         state = DELETEMSG;
         patchNo = patches.first().patchNo;    // PatchNo to delete from SD card
         patches.shift();                      // Remove patch from circular buffer
-        deletePatch(String(patchNo).c_str()); // Delete from SD card
+        deletePatch(text(patchNo)); // Delete from SD card
         loadPatches();                        // Repopulate circular buffer to start from lowest Patch No
         renumberPatchesOnSD();
         loadPatches();                     // Repopulate circular buffer again after delete
@@ -1417,7 +1552,7 @@ void updateSection(byte encIndex, bool moveUp) {
                     return;
                 }
                 case 3: {
-                    byte value = (groupvec[activeGroupIndex]->getOscFX() + 3 + (moveUp ? 1 : -1)) % 3;
+                    byte value = (groupvec[activeGroupIndex]->getOscFX() + 4 + (moveUp ? 1 : -1)) % 4;
                     midiCCOut(CCoscfx, value);
                     myControlChange(midiChannel, CCoscfx, value);
                     return;
@@ -1640,7 +1775,7 @@ void updateSection(byte encIndex, bool moveUp) {
             }
             break;
     }
-    showPatchPage(String(F("ERROR")) + String(encIndex), String((int)section));
+    showPatchPage(text(F("ERROR"), encIndex), (int)section);
 }
 
 FLASHMEM void myProgramChange(byte channel, byte program)
@@ -1733,7 +1868,7 @@ void checkEncoder()
       if (charIndex == TOTALCHARS)
         charIndex = 0; // Wrap around
       currentCharacter = CHARACTERS[charIndex++];
-      showRenamingPage(renamedPatch + currentCharacter);
+      showRenamingPage(renamedPatch, currentCharacter);
       break;
     case DELETE:
       patches.push(patches.shift());
@@ -1777,7 +1912,7 @@ void checkEncoder()
       if (charIndex == -1)
         charIndex = TOTALCHARS - 1;
       currentCharacter = CHARACTERS[charIndex--];
-      showRenamingPage(renamedPatch + currentCharacter);
+      showRenamingPage(renamedPatch, currentCharacter);
       break;
     case DELETE:
       patches.unshift(patches.pop());
@@ -1796,19 +1931,72 @@ void checkEncoder()
 
 void CPUMonitor()
 {
+  // Usage is a share of each block's time, the same work in smaller blocks
+  // costs more of it in per block overhead, see the teensy41_block envs
+  Serial.print(F(" BLOCK:"));
+  Serial.print(AUDIO_BLOCK_SAMPLES);
   Serial.print(F(" CPU:"));
   Serial.print(AudioProcessorUsage());
   Serial.print(F(" ("));
   Serial.print(AudioProcessorUsageMax());
   Serial.print(F(")"));
+  // Per voice filter cost, to judge how many voices can run the ladder
+  Serial.print(F("  SVF:"));
+  Serial.print(global.Oscillators[0].filter_.processorUsageMax());
+  Serial.print(F(" LADDER:"));
+  Serial.print(global.Oscillators[0].ladder_.processorUsageMax());
   Serial.print(F("  MEM:"));
-  Serial.println(AudioMemoryUsageMax());
+  Serial.print(AudioMemoryUsageMax());
+  Serial.print(F("/"));
+  Serial.print(audioMemoryBlocks);
+  // Sample operations saved by silent/constant block shortcuts since the
+  // last report
+  Serial.print(F("  SKIP:"));
+  Serial.print(AudioBlockTags::skipped);
+  // Heap in use, its high since setup(), free chunks in it and
+  // allocations while handling MIDI and drawing, see HeapMonitor.h
+  Serial.print(F("  HEAP:"));
+  Serial.print(HeapMonitor::used());
+  Serial.print(F("/"));
+  Serial.print(HeapMonitor::peakUsed());
+  Serial.print(F(" FRAG:"));
+  Serial.print(HeapMonitor::freeChunks());
+  Serial.print(F(" ALLOC:"));
+  Serial.print(HeapMonitor::midiAllocations);
+  Serial.print(F("/"));
+  Serial.println(HeapMonitor::frameAllocations);
+  AudioBlockTags::skipped = 0;
+  // Each voice stage's highest usage since the last report, every voice
+  // together, see Global::stageUsageMax()
+  Serial.print(F(" STAGES"));
+  for (uint8_t id = 0; id < SynthGraph::VOICE_NODES; id++)
+  {
+    Serial.print(F(" "));
+    Serial.print(SynthGraph::voiceNodes[id].name);
+    Serial.print(F(":"));
+    Serial.print(global.stageUsageMax(id));
+  }
+  Serial.println();
+  global.stageUsageMaxReset();
   delayMicroseconds(500);
 }
 
+// Voices, connections and mixer handles are all in place after setup()
+// and nothing in loop() should allocate for good, this reports each time
+// heap use reaches a new high
+void checkHeap()
+{
+  if (!HeapMonitor::grew()) return;
+  Serial.print(F("Heap grew after setup: +"));
+  Serial.println(HeapMonitor::peakUsed() - HeapMonitor::setupUsed());
+}
 
 FLASHMEM void setup()
 {
+    // Envelope coefficients for every panel time step, before any patch
+    // sets them
+    AudioEnvelopeCoefsTS::buildTables(ENVTIMES, 128);
+
     // Initialize the voice groups.
     uint8_t total = 0;
     while (total < global.maxVoices())
@@ -1829,7 +2017,31 @@ FLASHMEM void setup()
     setUpSettings();
     setupHardware();
 
-    AudioMemory(60);
+    // Sized from the audio graph rather than a guess, see SynthGraph.h,
+    // as long as the objects really update in the graph's order
+    if (global.inUpdateOrder())
+    {
+      AudioMemory(Global::AUDIO_MEMORY_BLOCKS);
+      Serial.print(F("Audio memory: "));
+      Serial.print(Global::AUDIO_MEMORY_BLOCKS);
+      Serial.print(F(" blocks, "));
+      Serial.print(Global::AUDIO_MEMORY_BLOCKS * sizeof(audio_block_t));
+      Serial.print(F(" bytes, "));
+      Serial.print(SynthGraph::AUDIO_MEMORY_MARGIN);
+      Serial.println(F(" spare"));
+    }
+    else
+    {
+      // Blocks wait a cycle in input queues, more than the plan allows
+      // for. The fixed pool from before, from the heap so that it's only
+      // taken when it's needed.
+      AudioStream::initialize_memory(new audio_block_t[Global::AUDIO_MEMORY_UNPLANNED], Global::AUDIO_MEMORY_UNPLANNED);
+      audioMemoryBlocks = Global::AUDIO_MEMORY_UNPLANNED;
+      Serial.print(F("Audio objects aren't declared in SynthGraph's order, audio memory: "));
+      Serial.print(Global::AUDIO_MEMORY_UNPLANNED);
+      Serial.println(F(" blocks"));
+    }
+    AudioBlockTags::begin();
     global.sgtl5000_1.enable();
     global.sgtl5000_1.volume(0.5 * SGTL_MAXVOLUME);
     global.sgtl5000_1.dacVolumeRamp();
@@ -1929,10 +2141,73 @@ FLASHMEM void setup()
     reloadFiltEnv();
     reloadAmpEnv();
     reloadGlideShape();
+    reloadQuality();
+
+    HeapMonitor::begin();
+}
+
+#ifdef KERNEL_BENCHMARK
+// Every float_kernels.h kernel in the synth on one variant and then the
+// other, 5 seconds each, printing the usage of one of each and the total.
+// Play a held chord with the filter moving: the usage maxima are reset at
+// each switch, so each line is the variant named on it.
+void kernelBenchmark()
+{
+  static elapsedMillis sinceSwitch;
+  static bool useFloat = false;
+  if (sinceSwitch < 5000) return;
+  sinceSwitch = 0;
+  Serial.print(useFloat ? F("FLOAT ") : F("FIXED "));
+  Serial.print(F(" SVF:"));
+  Serial.print(global.Oscillators[0].filter_.processorUsageMax());
+  Serial.print(F(" ENV:"));
+  Serial.print(global.Oscillators[0].ampEnvelope_.processorUsageMax());
+  Serial.print(F(" BUS:"));
+  Serial.print(global.SharedBus[0].voiceMixer.processorUsageMax());
+  Serial.print(F(" ENSEMBLE:"));
+  Serial.print(global.SharedBus[0].ensemble.processorUsageMax());
+  Serial.print(F("  CPU:"));
+  Serial.println(AudioProcessorUsageMax());
+  useFloat = !useFloat;
+  for (Patch &voice : global.Oscillators)
+  {
+    voice.filter_.useFloat(useFloat);
+    voice.filterEnvelope_.useFloat(useFloat);
+    voice.ampEnvelope_.useFloat(useFloat);
+    voice.filter_.processorUsageMaxReset();
+    voice.ampEnvelope_.processorUsageMaxReset();
+  }
+  for (PatchBus &bus : global.SharedBus)
+  {
+    bus.voiceMixer.useFloat(useFloat);
+    bus.ensemble.useFloat(useFloat);
+    bus.voiceMixer.processorUsageMaxReset();
+    bus.ensemble.processorUsageMaxReset();
+  }
+  global.outputMixer.useFloat(useFloat);
+  AudioProcessorUsageMaxReset();
+}
+#endif
+
+// Every QualityGovernor::CHECK_MS, the highest audio usage seen by loop()
+// since the last check to the governor, the voices follow its level. Reads
+// AudioProcessorUsage() rather than the maximum, so CPUMonitor() still
+// reports its own.
+void checkQuality()
+{
+  static elapsedMillis sinceCheck;
+  static float usageMax = 0.0f;
+  const float usage = AudioProcessorUsage();
+  if (usage > usageMax) usageMax = usage;
+  if (sinceCheck < QualityGovernor::CHECK_MS) return;
+  sinceCheck = 0;
+  if (qualityGovernor.update(usageMax)) applyQuality();
+  usageMax = 0.0f;
 }
 
 void loop()
 {
+  const uint32_t allocations = HeapMonitor::allocations;
   // USB HOST MIDI Class Compliant
   myusb.Task();
   midi1.read();
@@ -1940,6 +2215,7 @@ void loop()
   usbMIDI.read();
   // MIDI 5 Pin DIN
   MIDI.read();
+  HeapMonitor::midiAllocations += HeapMonitor::allocations - allocations;
    checkMux();
 
     checkVolumePot(); // Check here
@@ -1952,5 +2228,11 @@ void loop()
 //    }
    checkSwitches();
   checkEncoder();
+  checkHeap();
   // CPUMonitor();
+#ifdef KERNEL_BENCHMARK
+  kernelBenchmark();
+#else
+  checkQuality();
+#endif
 }
@@ -0,0 +1,64 @@
+#ifndef TSYNTH_TEXT_BUFFER_H
+#define TSYNTH_TEXT_BUFFER_H
+
+#include <Arduino.h>
+
+// Text printed into a fixed buffer, in place of String for anything done
+// per MIDI event or per display frame: nothing touches the heap. Numbers
+// come out as Print (and String) format them, floats to 2 places, and
+// anything past the capacity is dropped.
+template <size_t N>
+class TextBuffer : public Print {
+  public:
+    TextBuffer() { clear(); }
+
+    size_t write(uint8_t c) override {
+        if (len + 1 >= N) return 0;
+        text[len++] = c;
+        text[len] = 0;
+        return 1;
+    }
+    using Print::write;
+
+    void clear() {
+        len = 0;
+        text[0] = 0;
+    }
+
+    void append() {}
+
+    template <class T, class... Rest>
+    void append(const T &part, const Rest &...rest) {
+        print(part);
+        append(rest...);
+    }
+
+    // Replaces the text. The display thread may read it meanwhile, at
+    // worst it draws one frame with half of it.
+    template <class... T>
+    void set(const T &...parts) {
+        clear();
+        append(parts...);
+    }
+
+    size_t length() const { return len; }
+    const char *c_str() const { return text; }
+    operator const char *() const { return text; }
+
+  private:
+    char text[N];
+    size_t len;
+};
+
+// Long enough for any parameter name or value on the display
+static const size_t DISPLAY_CHARS = 24;
+
+// A display line from its parts, e.g. text(F("LFO "), rate, F(" Hz"))
+template <class... T>
+TextBuffer<DISPLAY_CHARS> text(const T &...parts) {
+    TextBuffer<DISPLAY_CHARS> t;
+    t.append(parts...);
+    return t;
+}
+
+#endif
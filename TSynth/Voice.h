@@ -45,8 +45,8 @@ class Voice {
             p.waveformMod_b.arbitraryWaveform(PARABOLIC_WAVE, AWFREQ);
         }
 
+        // The handle belongs to the voice's Patch
         inline void setMixer(Mixer* mixer_) {
-            delete mixer;
             mixer = mixer_;
         }
 
@@ -78,9 +78,18 @@ class Voice {
             return this->_oscillator;
         }
 
+        // Output level of the amp envelope, for choosing which voice to reuse
+        inline float level() {
+            return this->_oscillator.ampEnvelope_.getLevel();
+        }
+
         void updateVoice(VoiceParams &params, uint8_t notesOn) {
             Patch& osc = this->patch();
 
+            // A supersaw spreads its saws across the detune range itself
+            osc.waveformMod_a.supersaw(SUPERSAW_MAX_SAWS, 1.0f - params.detune);
+            osc.waveformMod_b.supersaw(SUPERSAW_MAX_SAWS, 1.0f - params.detune);
+
             if (params.unisonMode == 1) {
                 int offset = 2 * this->index();
                 osc.waveformMod_a.frequency(NOTEFREQS[this->_note + params.oscPitchA] * (params.detune + ((1 - params.detune) * DETUNE[notesOn - 1][offset])));
@@ -8,6 +8,7 @@
 #include "Voice.h"
 #include "MonoNoteHistory.h"
 #include "Constants.h"
+#include "Quality.h"
 
 #define VG_FOR_EACH_OSC(CMD) VG_FOR_EACH_VOICE(voices[i]->patch().CMD)
 #define VG_FOR_EACH_VOICE(CMD)                  \
@@ -60,6 +61,8 @@ private:
     float cutoff;
     float resonance;
     float filterMixer;
+    uint8_t filterControlRate;
+    uint8_t filterType;
     float filterEnvelope;
     float filterAttack;
     float filterDecay;
@@ -82,6 +85,7 @@ private:
     float modWhAmount;
     float effectAmount;
     float effectMix;
+    Quality quality;
 
     // Used to remember active mono notes.
     MonoNoteHistory noteStack;
@@ -111,6 +115,8 @@ public:
                                        cutoff(12000.0),
                                        resonance(1.1),
                                        filterMixer(0.0),
+                                       filterControlRate(1),
+                                       filterType(FILTERTYPESVF),
                                        filterEnvelope(0.0),
                                        filterAttack(100.0),
                                        filterDecay(350.0),
@@ -132,7 +138,8 @@ public:
                                        pitchLfoRate(4.0),
                                        modWhAmount(0.0),
                                        effectAmount(1.0),
-                                       effectMix(0.0)
+                                       effectMix(0.0),
+                                       quality(QUALITY_NORMAL)
     {
         _params.keytrackingAmount = 0.5; //Half - MIDI CC & settings option
         _params.mixerLevel = 0.0;
@@ -144,8 +151,8 @@ public:
         _params.oscPitchA = 0;
         _params.oscPitchB = 12;
 
-        shared.noiseMixer.gain(0, 0);
-        shared.noiseMixer.gain(1, 0);
+        shared.pinkNoiseGain(0);
+        shared.whiteNoiseGain(0);
 
         shared.pitchLfo.begin(WAVEFORM_SINE);
         shared.pwmLfoA.amplitude(ONE);
@@ -180,6 +187,8 @@ public:
     float getCutoff() { return cutoff; }
     float getResonance() { return resonance; }
     float getFilterMixer() { return filterMixer; }
+    uint8_t getFilterControlRate() { return filterControlRate; }
+    uint8_t getFilterType() { return filterType; }
     float getFilterEnvelope() { return filterEnvelope; }
     float getFilterAttack() { return filterAttack; }
     float getFilterDecay() { return filterDecay; }
@@ -218,20 +227,7 @@ public:
         if (waveformA == waveform)
             return;
         waveformA = waveform;
-
-        int temp = waveform;
-        if (waveform == WAVEFORM_PARABOLIC)
-        {
-            VG_FOR_EACH_OSC(waveformMod_a.arbitraryWaveform(PARABOLIC_WAVE, AWFREQ));
-            temp = WAVEFORM_ARBITRARY;
-        }
-        if (waveform == WAVEFORM_HARMONIC)
-        {
-            VG_FOR_EACH_OSC(waveformMod_a.arbitraryWaveform(HARMONIC_WAVE, AWFREQ));
-            temp = WAVEFORM_ARBITRARY;
-        }
-
-        VG_FOR_EACH_OSC(waveformMod_a.begin(temp))
+        applyWaveformA();
     }
 
     void setWaveformB(uint32_t waveform)
@@ -239,20 +235,7 @@ public:
         if (waveformB == waveform)
             return;
         waveformB = waveform;
-
-        int temp = waveform;
-        if (waveform == WAVEFORM_PARABOLIC)
-        {
-            VG_FOR_EACH_OSC(waveformMod_b.arbitraryWaveform(PARABOLIC_WAVE, AWFREQ));
-            temp = WAVEFORM_ARBITRARY;
-        }
-        if (waveform == WAVEFORM_HARMONIC)
-        {
-            VG_FOR_EACH_OSC(waveformMod_b.arbitraryWaveform(PPG_WAVE, AWFREQ));
-            temp = WAVEFORM_ARBITRARY;
-        }
-
-        VG_FOR_EACH_OSC(waveformMod_b.begin(temp))
+        applyWaveformB();
     }
 
     void setPwmRate(float value)
@@ -443,24 +426,26 @@ public:
         }
     }
 
-    void setWaveformMixerLevel(int channel, float level)
+    // Channel 0 is osc 1 (A), 1 osc 2 (B) and 2 the XOR of both
+    void setOscMixerLevel(int channel, float level)
     {
-        VG_FOR_EACH_OSC(waveformMixer_.gain(channel, level))
+        VG_FOR_EACH_OSC(oscillators_.gain(channel, level))
     }
 
-    void setOscModMixerA(int channel, float level)
+    // Osc 1 (A) or 2 (B) frequency modulated by the other one
+    void setOscCrossMod(uint8_t carrier, float level)
     {
-        VG_FOR_EACH_OSC(oscModMixer_a.gain(channel, level))
+        VG_FOR_EACH_OSC(oscillators_.crossModulation(carrier, level))
     }
 
-    void setOscModMixerB(int channel, float level)
+    void setOscFXCombineMode(AudioEffectDigitalCombine::combineMode mode)
     {
-        VG_FOR_EACH_OSC(oscModMixer_b.gain(channel, level))
+        VG_FOR_EACH_OSC(oscillators_.combineMode(mode))
     }
 
-    void setOscFXCombineMode(AudioEffectDigitalCombine::combineMode mode)
+    void setOscHardSync(bool enable)
     {
-        VG_FOR_EACH_OSC(oscFX_.setCombineMode(mode))
+        VG_FOR_EACH_OSC(oscillators_.hardSync(enable))
     }
 
     void setOscLevelA(float value)
@@ -470,22 +455,23 @@ public:
         switch (oscFX)
         {
         case 1:                                                       //XOR
-            setWaveformMixerLevel(0, oscLevelA);                      //Osc 1 (A)
-            setWaveformMixerLevel(3, (oscLevelA + oscLevelB) / 2.0f); //oscFX XOR level
+            setOscMixerLevel(0, oscLevelA);                      //Osc 1 (A)
+            setOscMixerLevel(2, (oscLevelA + oscLevelB) / 2.0f); //oscFX XOR level
             break;
         case 2: //XMod
             //osc A sounds with increasing osc B mod
             if (oscLevelA == 1.0f && oscLevelB <= 1.0f)
             {
-                setOscModMixerA(3, 1 - oscLevelB); //Feed from Osc 2 (B)
-                setWaveformMixerLevel(0, ONE);     //Osc 1 (A)
-                setWaveformMixerLevel(1, 0);       //Osc 2 (B)
+                setOscCrossMod(0, 1 - oscLevelB); //Feed from Osc 2 (B)
+                setOscMixerLevel(0, ONE);     //Osc 1 (A)
+                setOscMixerLevel(1, 0);       //Osc 2 (B)
             }
             break;
-        case 0:                                  //None
-            setOscModMixerA(3, 0);               //Feed from Osc 2 (B)
-            setWaveformMixerLevel(0, oscLevelA); //Osc 1 (A)
-            setWaveformMixerLevel(3, 0);         //XOR
+        case 0: //None
+        case 3: //Sync
+            setOscCrossMod(0, 0);               //Feed from Osc 2 (B)
+            setOscMixerLevel(0, oscLevelA); //Osc 1 (A)
+            setOscMixerLevel(2, 0);         //XOR
             break;
         }
     }
@@ -497,22 +483,23 @@ public:
         switch (oscFX)
         {
         case 1:                                                       //XOR
-            setWaveformMixerLevel(1, oscLevelB);                      //Osc 2 (B)
-            setWaveformMixerLevel(3, (oscLevelA + oscLevelB) / 2.0f); //oscFX XOR level
+            setOscMixerLevel(1, oscLevelB);                      //Osc 2 (B)
+            setOscMixerLevel(2, (oscLevelA + oscLevelB) / 2.0f); //oscFX XOR level
             break;
         case 2: //XMod
             //osc B sounds with increasing osc A mod
             if (oscLevelB == 1.0f && oscLevelA < 1.0f)
             {
-                setOscModMixerB(3, 1 - oscLevelA); //Feed from Osc 1 (A)
-                setWaveformMixerLevel(0, 0);       //Osc 1 (A)
-                setWaveformMixerLevel(1, ONE);     //Osc 2 (B)
+                setOscCrossMod(1, 1 - oscLevelA); //Feed from Osc 1 (A)
+                setOscMixerLevel(0, 0);       //Osc 1 (A)
+                setOscMixerLevel(1, ONE);     //Osc 2 (B)
             }
             break;
-        case 0:                                  //None
-            setOscModMixerB(3, 0);               //Feed from Osc 1 (A)
-            setWaveformMixerLevel(1, oscLevelB); //Osc 2 (B)
-            setWaveformMixerLevel(3, 0);         //XOR
+        case 0: //None
+        case 3: //Sync
+            setOscCrossMod(1, 0);               //Feed from Osc 1 (A)
+            setOscMixerLevel(1, oscLevelB); //Osc 2 (B)
+            setOscMixerLevel(2, 0);         //XOR
             break;
         }
     }
@@ -520,41 +507,43 @@ public:
     void setOscFX(uint8_t value)
     {
         oscFX = value;
+        //Osc 2 (B) restarts with each cycle of Osc 1 (A)
+        setOscHardSync(oscFX == 3);
 
         if (oscFX == 2)
         {
             if (oscLevelA == 1.0f && oscLevelB <= 1.0f)
             {
-                setOscModMixerA(3, 1 - oscLevelB); //Feed from Osc 2 (B)
-                setWaveformMixerLevel(0, ONE);     //Osc 1 (A)
-                setWaveformMixerLevel(1, 0);       //Osc 2 (B)
+                setOscCrossMod(0, 1 - oscLevelB); //Feed from Osc 2 (B)
+                setOscMixerLevel(0, ONE);     //Osc 1 (A)
+                setOscMixerLevel(1, 0);       //Osc 2 (B)
             }
             else
             {
-                setOscModMixerB(3, 1 - oscLevelA); //Feed from Osc 1 (A)
-                setWaveformMixerLevel(0, 0);       //Osc 1 (A)
-                setWaveformMixerLevel(1, ONE);     //Osc 2 (B)
+                setOscCrossMod(1, 1 - oscLevelA); //Feed from Osc 1 (A)
+                setOscMixerLevel(0, 0);       //Osc 1 (A)
+                setOscMixerLevel(1, ONE);     //Osc 2 (B)
             }
             //Set XOR type off
             setOscFXCombineMode(AudioEffectDigitalCombine::OFF);
-            setWaveformMixerLevel(3, 0); //XOR
+            setOscMixerLevel(2, 0); //XOR
         }
         else if (oscFX == 1)
         {
-            setOscModMixerA(3, 0); //XMod off
-            setOscModMixerB(3, 0); //XMod off
+            setOscCrossMod(0, 0); //XMod off
+            setOscCrossMod(1, 0); //XMod off
             //XOR 'Ring Mod' type effect
             setOscFXCombineMode(AudioEffectDigitalCombine::XOR);
-            setWaveformMixerLevel(3, (oscLevelA + oscLevelB) / 2.0f); //XOR on
+            setOscMixerLevel(2, (oscLevelA + oscLevelB) / 2.0f); //XOR on
         }
         else
         {
-            setOscModMixerA(3, 0);                               //XMod off
-            setOscModMixerB(3, 0);                               //XMod off
+            setOscCrossMod(0, 0);                               //XMod off
+            setOscCrossMod(1, 0);                               //XMod off
             setOscFXCombineMode(AudioEffectDigitalCombine::OFF); //Set XOR type off
-            setWaveformMixerLevel(0, oscLevelA);                 //Osc 1 (A)
-            setWaveformMixerLevel(1, oscLevelB);                 //Osc 2 (B)
-            setWaveformMixerLevel(3, 0);                         //XOR off
+            setOscMixerLevel(0, oscLevelA);                 //Osc 1 (A)
+            setOscMixerLevel(1, oscLevelB);                 //Osc 2 (B)
+            setOscMixerLevel(2, 0);                         //XOR off
         }
     }
 
@@ -563,6 +552,7 @@ public:
         this->cutoff = value;
 
         VG_FOR_EACH_OSC(filter_.frequency(value))
+        VG_FOR_EACH_OSC(ladder_.frequency(value))
 
         float filterOctave = 0.0;
         //Altering filterOctave to give more cutoff width for deeper bass, but sharper cuttoff at higher frequncies
@@ -584,12 +574,14 @@ public:
         }
 
         VG_FOR_EACH_OSC(filter_.octaveControl(filterOctave))
+        VG_FOR_EACH_OSC(ladder_.octaveControl(filterOctave))
     }
 
     void setResonance(float value)
     {
         resonance = value;
         VG_FOR_EACH_OSC(filter_.resonance(value))
+        VG_FOR_EACH_OSC(ladder_.resonance(value))
     }
 
     void setFilterMixer(float value)
@@ -615,12 +607,46 @@ public:
             HP = value;
         }
 
-        VG_FOR_EACH_VOICE(
-            voices[i]->patch().filterMixer_.gain(0, LP);
-            voices[i]->patch().filterMixer_.gain(1, BP);
-            voices[i]->patch().filterMixer_.gain(2, HP);)
+        //The filter writes the mix as one block. filterMixer_ stays at
+        //unity and passes through whichever filter is selected, the
+        //ladder is lowpass only and ignores the mix.
+        VG_FOR_EACH_OSC(filter_.mixOutput(LP, BP, HP))
+    }
+
+    // State variable (12dB, LP/BP/HP mix) or ladder (24dB lowpass). Only
+    // the selected filter is fed, so the other costs nothing. The ladder
+    // is dearer per voice, see CPUMonitor() for both.
+    void setFilterType(uint8_t type)
+    {
+        filterType = type == FILTERTYPELADDER ? FILTERTYPELADDER : FILTERTYPESVF;
+        VG_FOR_EACH_OSC(selectFilter(filterType))
+    }
+
+    // Samples between filter cutoff updates from the modulation input,
+    // 1 for every sample. Higher values trade sweep accuracy for CPU.
+    void setFilterControlRate(uint8_t samples)
+    {
+        filterControlRate = samples < 1 ? 1 : samples;
+        VG_FOR_EACH_OSC(filter_.controlRate(qualityControlRate()))
+    }
+
+    // The quality the voices play at, see Quality.h. The patch keeps its
+    // own waveforms and control rate, this only changes what they run as.
+    void setQuality(Quality level)
+    {
+        if (quality == level)
+            return;
+        quality = level;
+        const QualitySettings &q = QUALITY_SETTINGS[quality];
+        applyWaveformA();
+        applyWaveformB();
+        VG_FOR_EACH_OSC(filter_.oversample(q.svfOversample))
+        VG_FOR_EACH_OSC(ladder_.oversample(q.ladderOversample))
+        VG_FOR_EACH_OSC(filter_.controlRate(qualityControlRate()))
     }
 
+    Quality getQuality() { return quality; }
+
     void setFilterModMixer(int channel, float level)
     {
         VG_FOR_EACH_OSC(filterModMixer_.gain(channel, level))
@@ -635,13 +661,13 @@ public:
     void setFilterAttack(float value)
     {
         filterAttack = value;
-        VG_FOR_EACH_OSC(filterEnvelope_.attack(value))
+        shared.filterEnvelopeCoefs.attack(value);
     }
 
     void setFilterDecay(float value)
     {
         filterDecay = value;
-        VG_FOR_EACH_OSC(filterEnvelope_.decay(value))
+        shared.filterEnvelopeCoefs.decay(value);
     }
 
     void setFilterSustain(float value)
@@ -653,19 +679,19 @@ public:
     void setFilterRelease(float value)
     {
         filterRelease = value;
-        VG_FOR_EACH_OSC(filterEnvelope_.release(value))
+        shared.filterEnvelopeCoefs.release(value);
     }
 
     void setAmpAttack(float value)
     {
         ampAttack = value;
-        VG_FOR_EACH_OSC(ampEnvelope_.attack(value))
+        shared.ampEnvelopeCoefs.attack(value);
     }
 
     void setAmpDecay(float value)
     {
         ampDecay = value;
-        VG_FOR_EACH_OSC(ampEnvelope_.decay(value))
+        shared.ampEnvelopeCoefs.decay(value);
     }
 
     void setAmpSustain(float value)
@@ -677,7 +703,7 @@ public:
     void setAmpRelease(float value)
     {
         ampRelease = value;
-        VG_FOR_EACH_OSC(ampEnvelope_.release(value))
+        shared.ampEnvelopeCoefs.release(value);
     }
 
     void setKeytracking(float value)
@@ -721,7 +747,7 @@ public:
             gain = 1.0;
         else
             gain = UNISONNOISEMIXERLEVEL;
-        shared.noiseMixer.gain(0, pinkLevel * gain);
+        shared.pinkNoiseGain(pinkLevel * gain);
     }
 
     void setWhiteNoiseLevel(float value)
@@ -732,7 +758,7 @@ public:
             gain = 1.0;
         else
             gain = UNISONNOISEMIXERLEVEL;
-        shared.noiseMixer.gain(1, whiteLevel * gain);
+        shared.whiteNoiseGain(whiteLevel * gain);
     }
 
     void setPitchLfoRetrig(bool value)
@@ -770,16 +796,17 @@ public:
     void setEffectAmount(float value)
     {
         effectAmount = value;
-        shared.ensemble.lfoRate(effectAmount);
+        shared.bus->ensemble.lfoRate(effectAmount);
     }
 
     void setEffectMix(float value)
     {
         effectMix = value;
-        shared.effectMixerL.gain(0, 1.0f - effectMix); //Dry
-        shared.effectMixerL.gain(1, effectMix);        //Wet
-        shared.effectMixerR.gain(0, 1.0f - effectMix); //Dry
-        shared.effectMixerR.gain(1, effectMix);        //Wet
+        shared.bus->effectMixerL.gain(0, 1.0f - effectMix); //Dry
+        shared.bus->effectMixerL.gain(1, effectMix);        //Wet
+        shared.bus->effectMixerR.gain(0, 1.0f - effectMix); //Dry
+        shared.bus->effectMixerR.gain(1, effectMix);        //Wet
+        shared.bus->ensemble.bypass(effectMix == 0.0f);
     }
 
     inline void setMonophonic(uint8_t mode)
@@ -961,6 +988,49 @@ public:
     Voice *operator[](int i) const { return voices[i]; }
 
 private:
+    void applyWaveformA()
+    {
+        int temp = qualityWaveform(waveformA, quality);
+        if (waveformA == WAVEFORM_PARABOLIC)
+        {
+            VG_FOR_EACH_OSC(waveformMod_a.arbitraryWaveform(PARABOLIC_WAVE, AWFREQ));
+            temp = WAVEFORM_ARBITRARY;
+        }
+        if (waveformA == WAVEFORM_HARMONIC)
+        {
+            VG_FOR_EACH_OSC(waveformMod_a.arbitraryWaveform(HARMONIC_WAVE, AWFREQ));
+            temp = WAVEFORM_ARBITRARY;
+        }
+
+        VG_FOR_EACH_OSC(waveformMod_a.begin(temp))
+    }
+
+    void applyWaveformB()
+    {
+        int temp = qualityWaveform(waveformB, quality);
+        if (waveformB == WAVEFORM_PARABOLIC)
+        {
+            VG_FOR_EACH_OSC(waveformMod_b.arbitraryWaveform(PARABOLIC_WAVE, AWFREQ));
+            temp = WAVEFORM_ARBITRARY;
+        }
+        if (waveformB == WAVEFORM_HARMONIC)
+        {
+            VG_FOR_EACH_OSC(waveformMod_b.arbitraryWaveform(PPG_WAVE, AWFREQ));
+            temp = WAVEFORM_ARBITRARY;
+        }
+
+        VG_FOR_EACH_OSC(waveformMod_b.begin(temp))
+    }
+
+    // The patch's control rate within what the quality level allows
+    uint8_t qualityControlRate()
+    {
+        const QualitySettings &q = QUALITY_SETTINGS[quality];
+        if (filterControlRate < q.minControlRate)
+            return q.minControlRate;
+        return filterControlRate > q.maxControlRate ? q.maxControlRate : filterControlRate;
+    }
+
     void handleMonophonicNoteOn(uint8_t note, uint8_t velocity)
     {
         noteStack.push(note, velocity);
@@ -1053,18 +1123,30 @@ private:
         return;
     }
 
-    // Get the oldest free voice, of none free get the oldest active voice.
+    // Get the quietest free voice (oldest if equal), so the release tail
+    // that gets cut is the least audible. If none free get the oldest
+    // active voice.
     Voice *getVoice()
     {
         Voice *result = nullptr;
+        float resultLevel = 0;
 
         for (uint8_t i = 0; i < voices.size(); i++)
         {
             if (result == nullptr || !voices[i]->on() || result->on())
             {
-                if (result == nullptr || voices[i]->timeOn() < result->timeOn())
+                if (result != nullptr && !voices[i]->on() && result->on())
+                {
+                    // First free voice beats any active one
+                    result = voices[i];
+                    resultLevel = result->level();
+                    continue;
+                }
+                float level = voices[i]->on() ? 0 : voices[i]->level();
+                if (result == nullptr || level < resultLevel || (level == resultLevel && voices[i]->timeOn() < result->timeOn()))
                 {
                     result = voices[i];
+                    resultLevel = level;
                 }
             }
         }
@@ -0,0 +1,48 @@
+/* Audio Library for Teensy 3.X
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "block_tags.h"
+
+uint32_t AudioBlockTags::skipped = 0;
+
+// The pool lives in DMAMEM, which isn't cleared at start up, and
+// AudioMemory() only numbers the blocks. Take every free block once, chained
+// through its own data, clear its tag and hand them all back. An update
+// landing in between finds the pool empty for one cycle, as it would when
+// out of memory, which is harmless during setup().
+FLASHMEM void AudioBlockTags::begin(void)
+{
+	audio_block_t *list = NULL, *block;
+
+	while ((block = allocate()) != NULL) {
+		block->reserved1 = AUDIO_BLOCK_TAG_NONE;
+		memcpy(block->data, &list, sizeof(list));
+		list = block;
+	}
+	while (list) {
+		block = list;
+		memcpy(&list, block->data, sizeof(list));
+		AudioStream::release(block);
+	}
+	AudioMemoryUsageMaxReset();
+	skipped = 0;
+}
@@ -0,0 +1,68 @@
+/* Audio Library for Teensy 3.X
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// Content tags for audio blocks, kept in the spare audio_block_t::reserved1
+// byte. A block tagged AUDIO_BLOCK_TAG_CONSTANT holds data[0] in every
+// sample, so a consumer can treat it as one value instead of 128. Silence is
+// still a missing block, as everywhere else in the library.
+//
+// Free blocks always carry AUDIO_BLOCK_TAG_NONE, so objects that never tag
+// anything need no changes. To keep it that way:
+//  - AudioBlockTags::begin() clears the whole pool once after AudioMemory()
+//  - objects that may hold a tagged block release it through
+//    AudioBlockTags::release(), which clears the tag with the last reference
+//  - a tagged block is only ever transmitted to such objects: in TSynth the
+//    mixers, the filters and the modulated waveforms (see AudioPatching.h)
+//
+// AudioBlockTags::skipped counts the sample operations the shortcuts saved,
+// CPUMonitor() prints and clears it.
+
+#ifndef block_tags_h_
+#define block_tags_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+
+#define AUDIO_BLOCK_TAG_NONE		0
+#define AUDIO_BLOCK_TAG_CONSTANT	1
+
+class AudioBlockTags : public AudioStream
+{
+public:
+	static void begin(void);
+	static bool isConstant(const audio_block_t *block) {
+		return block->reserved1 == AUDIO_BLOCK_TAG_CONSTANT;
+	}
+	static void tag(audio_block_t *block, uint8_t tag) {
+		block->reserved1 = tag;
+	}
+	static void release(audio_block_t *block) {
+		if (block->ref_count == 1) block->reserved1 = AUDIO_BLOCK_TAG_NONE;
+		AudioStream::release(block);
+	}
+	static uint32_t skipped;
+private:
+	// static helpers only, derived from AudioStream for the pool access
+	AudioBlockTags(void) : AudioStream(0, NULL) {}
+	virtual void update(void) {}
+};
+
+#endif
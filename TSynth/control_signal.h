@@ -0,0 +1,42 @@
+/* Audio Library for Teensy 3.X
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// A control rate signal: one value per audio block plus a linear ramp from
+// the value before the block, instead of a 128 sample audio block.
+//
+// Slow modulation sources (note tracking, glide, pitch bend, pulse width)
+// publish one of these and mixers read it directly, see
+// AudioSynthWaveformDcTS::controlSignal() and AudioMixer4TS::control().
+// Values are in 16.16 sample units: value >> 16 is the sample an audio block
+// of the same signal would hold.
+
+#ifndef control_signal_h_
+#define control_signal_h_
+
+#include <stdint.h>
+
+struct AudioControlSignal
+{
+	int32_t start;	// before the first sample of the block
+	int32_t end;	// at the last sample of the block
+};
+
+#endif
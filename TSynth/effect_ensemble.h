@@ -21,35 +21,42 @@
    THE SOFTWARE.
 */
 
-// V. Pearson: Implemented delay buffer interpolation with floating point fractional indices and using a larger table
-// to reduce audible delay sweep quantization noise.
-// The fractional indices are stored in flash memory instead of being calculated at runtime and stored in RAM.
-// #define LARGE_ENSEMBLE_LFO_TABLE uses a larger lfo table with only delay buffer interpolation.
-// This is more precise and is slightly faster but takes more flash memory.
-// With it undefined, lfo table and delay buffer interpolation are implemented with some extra processing and a smaller lfo table. 
-
-#define LARGE_ENSEMBLE_LFO_TABLE
+// V. Pearson: Implemented delay buffer interpolation with fractional indices to reduce audible delay
+// sweep quantization noise.
+//
+// Fixed point version: the delay taps are Q16 positions into a power of two ring buffer and the
+// LFO is a 32 bit phasor. The LFO is only evaluated at block boundaries and each tap's delay is
+// ramped linearly across the block, interpolating the buffer in Q15.
+//
+// With no input for longer than the buffer, or when bypassed, the effect sleeps: it transmits
+// nothing and skips the taps. The LFO keeps running, so waking up continues exactly where an
+// effect that never slept would be.
 
 #ifndef effect_ensemble_h_
 #define effect_ensemble_h_
 
 #include <Arduino.h>
 #include "AudioStream.h"
-#define ENSEMBLE_BUFFER_SIZE 1024
+#include "memory_placement.h"
+#include "float_kernels.h"
+#define ENSEMBLE_BUFFER_SIZE 1024 // must be a power of two and a multiple of AUDIO_BLOCK_SAMPLES
+#define ENSEMBLE_BUFFER_MASK (ENSEMBLE_BUFFER_SIZE - 1)
+static_assert(ENSEMBLE_BUFFER_SIZE % AUDIO_BLOCK_SAMPLES == 0, "a block must never wrap in the delay line");
 // to put a channel 90 degrees out of LFO phase for stereo spread
 #define PHASE_90 367
-
-// LFO wavetable parameters
-#ifdef LARGE_ENSEMBLE_LFO_TABLE
-  #define LFO_SAMPLES (1470*4) // number of samples in tablle
-  #define LFO_SIZE (1470*4) // number of effective values (no interpolation so same as table size).
-  #define COUNTS_PER_LFO (200/4) // Adjust for larger table so the rate is the same.
-#else
-  #define LFO_SAMPLES 1470 // number of samples in table
-  #define LFO_SIZE (1470*4) // number of effective values interpolated from table
-  #define COUNTS_PER_LFO (200/4) // Adjust for larger effective table so the rate is the same.
-#endif
-
+// number of delay taps summed into each output
+#define ENSEMBLE_TAPS 6
+
+// LFO rate parameters. One LFO cycle takes LFO_SIZE steps of countsPerLfo + 1 samples,
+// as with the original stepped table.
+#define LFO_SIZE (1470*4)
+#define COUNTS_PER_LFO (200/4)
+// taps are 245 of the LFO_SIZE steps apart
+#define LFO_TAP_SPACING 245
+
+// LFO wavetable, Q16 delay offsets in samples
+#define LFO_TABLE_BITS 10
+#define LFO_TABLE_SIZE (1 << LFO_TABLE_BITS)
 #define LFO_RANGE 110
 
 class AudioEffectEnsemble : public AudioStream
@@ -58,50 +65,33 @@ class AudioEffectEnsemble : public AudioStream
     AudioEffectEnsemble(void);
     virtual void update(void);
     void lfoRate(float rate);
+    // Stop producing output, e.g. when the wet mix is zero. The input is
+    // still buffered so switching back in doesn't replay stale audio.
+    void bypass(bool enable) { bypassed = enable; }
+    // Interpolate and sum the taps in float32, see float_kernels.h
+    void useFloat(bool enable) { floatTaps = enable; }
 
   private:
     audio_block_t *inputQueueArray[1];
     // buffers
     int16_t delayBuffer[ENSEMBLE_BUFFER_SIZE];
 
-    // LFO wavetable
-    const static float PROGMEM lfoTable[];
-
-    // input index
-    int16_t inIndex;
-    // output indexes
-    // default to csenter of buffer
-    int16_t outIndex1;
-    int16_t outIndex2;
-    int16_t outIndex3;
-    int16_t outIndex4;
-    int16_t outIndex5;
-    int16_t outIndex6;
-    // lfo index
-    // seprated by thirds to approximate 120 degree phase relationship
-    int16_t lfoIndex1;
-    int16_t lfoIndex2;
-    int16_t lfoIndex3;
-    int16_t lfoIndex4;
-    int16_t lfoIndex5;
-    int16_t lfoIndex6;
-    // lfo rate counter
-    int16_t lfoCount;
-    // output index offset
-    float offset1;
-    float offset2;
-    float offset3;
-    float offset4;
-    float offset5;
-    float offset6;
-    //Default countsPerLfo
-    int countsPerLfo = COUNTS_PER_LFO;
-    int16_t interpBuffer(float findex);
-    
-    #ifndef LARGE_ENSEMBLE_LFO_TABLE
-    float lfoLookup(int16_t lfoIndex);
-    #endif
-
+    // LFO wavetable, one extra entry so interpolation never wraps
+    const static int32_t FASTDATA lfoTable[LFO_TABLE_SIZE + 1];
+
+    // where the next input block is written, counts samples and is masked on use
+    uint32_t inIndex;
+    // samples of silent input since the last block, the effect sleeps once
+    // its whole buffer has been filled with silence
+    uint32_t silentSamples;
+    bool bypassed;
+    bool floatTaps;
+    // LFO phasor and its increment per sample
+    uint32_t lfoPhase;
+    uint32_t lfoPhaseInc;
+    // Q16 delay offset of each tap at the end of the last block
+    int32_t tapOffset[ENSEMBLE_TAPS];
+    int32_t lfoLookup(uint32_t phase);
 };
 
 
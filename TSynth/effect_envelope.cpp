@@ -27,6 +27,7 @@
 
 #include <Arduino.h>
 #include "effect_envelope.h"
+#include "block_tags.h"
 
 
 #define RELEASE_BIAS 256 // based on a 1.31 fixed point integer. This is the level below zero that is the release target and causes the output to go to zero earlier. Otherwise it can take a relatively long time.
@@ -37,18 +38,155 @@
 // Form 2 for remaining stages: y(n+1) = k1*(y(n)-x(n))+x(n) using unsigned S1.30 fixed point format
 #define EXP_ENV_FILT2(k,y,x) ((((int64_t)(k)*(int64_t)(y-x))>>30)+(x))
 #define YSUM2MULT(x) ((x)>>14)
+// Generator mode output, what the effect gives for an input of DC 1.0
+#define ENV_GENERATE(m) ((int16_t)signed_multiply_32x16b((m), 0x7FFF))
+
+// Coefficient tables, filled by buildTables() and buildAttackTables(). Index
+// is the position of the time in table_ms. There are only attack tables for
+// the curve types in use, attack_type says which; -128 is an empty slot.
+static const uint16_t *table_ms = NULL;
+static uint8_t table_size = 0;
+static int32_t DMAMEM decay_k_table[ENV_TABLE_MAX];
+static int32_t DMAMEM attack_k_table[ENV_ATTACK_TABLES][ENV_TABLE_MAX];
+static int32_t DMAMEM attack_target_table[ENV_ATTACK_TABLES][ENV_TABLE_MAX];
+static int8_t attack_type[ENV_ATTACK_TABLES] = {-128, -128};
+
+static int32_t exp_decay_k(uint16_t count)
+{
+  return (int32_t)(EXP_ENV_ONE*exp(-1.0L/(count*4.0L)));
+}
+
+static void exp_attack(int8_t type, uint16_t count, int32_t &k, int32_t &target)
+{
+  double k1,k2;
+  k1=exp((double)type/(count*8.0L));
+  k2=(k1-1.0L)/(exp((double)type)-1.0L);
+  k=(uint32_t)(EXP_ENV_ONE*k1);
+  target=(uint32_t)(EXP_ENV_ONE*k2);
+}
+
+// Position of milliseconds in table_ms, -1 if it isn't one of them
+static int16_t table_index(float milliseconds)
+{
+  int16_t lo = 0, hi = (int16_t)table_size - 1;
+  while (lo <= hi) {
+    int16_t mid = (lo + hi) >> 1;
+    if (table_ms[mid] == milliseconds) return mid;
+    if (table_ms[mid] < milliseconds) lo = mid + 1;
+    else hi = mid - 1;
+  }
+  return -1;
+}
+
+FLASHMEM void AudioEnvelopeCoefsTS::buildTables(const uint16_t *milliseconds, uint8_t n)
+{
+  if (n > ENV_TABLE_MAX) n = ENV_TABLE_MAX;
+  table_size = 0; // Don't look anything up while the tables change
+  for (uint8_t i=0; i < n; i++) {
+    uint16_t count = milliseconds2count(milliseconds[i]);
+    if (count == 0) count = 1;
+    decay_k_table[i] = exp_decay_k(count);
+  }
+  for (uint8_t t=0; t < ENV_ATTACK_TABLES; t++) attack_type[t] = -128;
+  table_ms = milliseconds;
+  table_size = n;
+}
+
+FLASHMEM void AudioEnvelopeCoefsTS::buildAttackTables(const int8_t *types, uint8_t n)
+{
+  if (n > ENV_ATTACK_TABLES) n = ENV_ATTACK_TABLES;
+  for (uint8_t t=0; t < ENV_ATTACK_TABLES; t++) {
+    int8_t type = t < n ? types[t] : -128;
+    if (type>8 || type<-8 || type==0) type = -128; // linear, nothing to tabulate
+    if (type == attack_type[t]) continue;
+    attack_type[t] = -128; // Don't look it up while it changes
+    if (type == -128) continue;
+    for (uint8_t i=0; i < table_size; i++) {
+      uint16_t count = milliseconds2count(table_ms[i]);
+      if (count == 0) count = 1;
+      exp_attack(type, count, attack_k_table[t][i], attack_target_table[t][i]);
+    }
+    attack_type[t] = type;
+  }
+}
+
+FLASHMEM void AudioEnvelopeCoefsTS::attack(float milliseconds)
+{
+  attack_count = milliseconds2count(milliseconds);
+  if(attack_count==0) attack_count=1; //************* added check for div/0
+  attack_index = table_index(milliseconds);
+  updateExpAttack();
+}
+
+FLASHMEM void AudioEnvelopeCoefsTS::decay(float milliseconds)
+{
+  int16_t i = table_index(milliseconds);
+  decay_count = milliseconds2count(milliseconds);
+  if (decay_count == 0) decay_count = 1;
+  decay_k = i < 0 ? exp_decay_k(decay_count) : decay_k_table[i];
+}
+
+// Same curve as decay, so it shares the decay table
+FLASHMEM void AudioEnvelopeCoefsTS::release(float milliseconds)
+{
+  int16_t i = table_index(milliseconds);
+  release_count = milliseconds2count(milliseconds);
+  if (release_count == 0) release_count = 1;
+  release_k = i < 0 ? exp_decay_k(release_count) : decay_k_table[i];
+}
+
+FLASHMEM void AudioEnvelopeCoefsTS::releaseNoteOn(float milliseconds)
+{
+  double k;
+  release_forced_count = milliseconds2count(milliseconds);
+  // Increased forced release rate x4 so it will end before the next note off call.
+  // Unlike linear mode this time is dependant on sustain level and release rate. It may be better to implement this state as a linear ramp with a fixed time
+  // for consistent behaviour.
+  k=exp(-4.0L/(release_forced_count*8.0L));
+  release_forced_k=(uint32_t)(EXP_ENV_ONE*k);
+}
+
+FLASHMEM void AudioEnvelopeCoefsTS::setEnvType(int8_t type)
+{
+  env_type=type;
+  updateExpAttack(); // Exponential attack parameters need updating.
+}
+
+// This is needed in case env type changes.
+FLASHMEM void AudioEnvelopeCoefsTS::updateExpAttack()
+{
+  if(env_type>8 || env_type<-8) return; // Anything outside this range is a linear envelope.
+  if(env_type==0) // Linear attack. Everything else is exponential.
+  {
+    attack_k=EXP_ENV_ONE;
+    attack_target=(uint32_t)(EXP_ENV_ONE/(attack_count*8.0L));
+    return;
+  }
+  if (attack_index < 0 || attack_index >= table_size) {
+    exp_attack(env_type, attack_count, attack_k, attack_target);
+    return;
+  }
+  for (uint8_t t=0; t < ENV_ATTACK_TABLES; t++) {
+    if (attack_type[t] == env_type) {
+      attack_k = attack_k_table[t][attack_index];
+      attack_target = attack_target_table[t][attack_index];
+      return;
+    }
+  }
+  exp_attack(env_type, attack_count, attack_k, attack_target);
+}
 
 void AudioEffectEnvelopeTS::noteOn(void)
 {
   __disable_irq();
-  if(release_forced_count==0)
+  if(coefs->release_forced_count==0)
     state=STATE_IDLE;
   switch(state)
   {
 
     case STATE_IDLE:
     case STATE_IDLE_NEXT:
-      count=delay_count;
+      count=coefs->delay_count;
       if(count>0)
       {
         state=STATE_DELAY;
@@ -57,7 +195,7 @@ void AudioEffectEnvelopeTS::noteOn(void)
       else
       {
         state=STATE_ATTACK;
-        count=attack_count;
+        count=coefs->attack_count;
       inc_hires = 0x40000000 / (int32_t)count;
       }
       break;    
@@ -69,7 +207,7 @@ void AudioEffectEnvelopeTS::noteOn(void)
     case STATE_SUSTAIN_FAST_CHANGE:
     case STATE_RELEASE:
       state=STATE_FORCED;
-      count=release_forced_count;
+      count=coefs->release_forced_count;
       inc_hires=(-mult_hires)/(int32_t)count;
     case STATE_FORCED:
       break;
@@ -92,47 +230,307 @@ void AudioEffectEnvelopeTS::noteOff(void)
       break;
     default:
       state = STATE_RELEASE;
-      count = release_count;
+      count = coefs->release_count;
       inc_hires = (-mult_hires) / (int32_t)count;
   }
   __enable_irq();
 }
 
-void AudioEffectEnvelopeTS::update(void)
+// Gain stages. n samples from p, in place; generator mode writes what an
+// input of DC 1.0 would give. Pairs of samples go through the dual 16 bit
+// multiplies, p may start on an odd sample.
+static inline void env_apply_constant(int16_t *p, int32_t mult, uint32_t n, bool generate)
 {
-  audio_block_t *block;
-  uint32_t *p, *end;
+  int16_t *end = p + n;
+  uint32_t *pair, *pairs_end, sample12, tmp1, tmp2;
+
+  if (generate) {
+    const int16_t value = ENV_GENERATE(mult);
+    const uint32_t packed = pack_16b_16b(value, value);
+    if (((uintptr_t)p & 2) && p < end) *p++ = value;
+    pair = (uint32_t *)p;
+    pairs_end = pair + ((end - p) >> 1);
+    while (pair < pairs_end) *pair++ = packed;
+    p = (int16_t *)pair;
+    if (p < end) *p = value;
+    return;
+  }
+  if (((uintptr_t)p & 2) && p < end) {
+    *p = signed_multiply_32x16b(mult, *p);
+    p++;
+  }
+  pair = (uint32_t *)p;
+  pairs_end = pair + ((end - p) >> 1);
+  while (pair < pairs_end) {
+    sample12 = *pair;
+    tmp1 = signed_multiply_32x16b(mult, sample12);
+    tmp2 = signed_multiply_32x16t(mult, sample12);
+    *pair++ = pack_16b_16b(tmp2, tmp1);
+  }
+  p = (int16_t *)pair;
+  if (p < end) *p = signed_multiply_32x16b(mult, *p);
+}
+
+static inline void env_apply(int16_t *p, const int32_t *mult, uint32_t n, bool generate)
+{
+  for (uint32_t i=0; i < n; i++) {
+    p[i] = generate ? ENV_GENERATE(mult[i]) : signed_multiply_32x16b(mult[i], p[i]);
+  }
+}
+
+// Linear ramp over 8 samples, the original AudioEffectEnvelope inner loop
+static inline void env_apply_ramp8(int16_t *p, int32_t mult, int32_t inc, bool generate)
+{
+  uint32_t *pair = (uint32_t *)p;
   uint32_t sample12, sample34, sample56, sample78, tmp1, tmp2;
-  uint32_t exp_mult[8];
 
-  block = receiveWritable();
-  if (!block) return;
-  if (state == STATE_IDLE) {
-    release(block);
+  if (generate) {
+    for (int i=0; i < 8; i++) {
+      mult += inc;
+      p[i] = ENV_GENERATE(mult);
+    }
     return;
   }
-  p = (uint32_t *)(block->data);
-  end = p + AUDIO_BLOCK_SAMPLES/2;
-  if(env_type==-128)
+  sample12 = pair[0];
+  sample34 = pair[1];
+  sample56 = pair[2];
+  sample78 = pair[3];
+  mult += inc;
+  tmp1 = signed_multiply_32x16b(mult, sample12);
+  mult += inc;
+  tmp2 = signed_multiply_32x16t(mult, sample12);
+  sample12 = pack_16b_16b(tmp2, tmp1);
+  mult += inc;
+  tmp1 = signed_multiply_32x16b(mult, sample34);
+  mult += inc;
+  tmp2 = signed_multiply_32x16t(mult, sample34);
+  sample34 = pack_16b_16b(tmp2, tmp1);
+  mult += inc;
+  tmp1 = signed_multiply_32x16b(mult, sample56);
+  mult += inc;
+  tmp2 = signed_multiply_32x16t(mult, sample56);
+  sample56 = pack_16b_16b(tmp2, tmp1);
+  mult += inc;
+  tmp1 = signed_multiply_32x16b(mult, sample78);
+  mult += inc;
+  tmp2 = signed_multiply_32x16t(mult, sample78);
+  sample78 = pack_16b_16b(tmp2, tmp1);
+  pair[0] = sample12;
+  pair[1] = sample34;
+  pair[2] = sample56;
+  pair[3] = sample78;
+}
+
+// The same gain stages in float32, the gain taken from the 2.30 envelope
+// level rather than its top 16 bits
+#define ENV_GAIN_SCALE (1.0f / 1073741824.0f)
+
+static inline void env_apply_constant_f32(int16_t *p, float gain, uint32_t n, bool generate)
+{
+  int16_t *end = p + n;
+
+  if (generate) {
+    const int16_t value = float_to_int16(32767.0f * gain);
+    while (p < end) *p++ = value;
+    return;
+  }
+  while (p < end) {
+    *p = (int16_t)(*p * gain);
+    p++;
+  }
+}
+
+static inline void env_apply_f32(int16_t *p, const float *gain, uint32_t n, bool generate)
+{
+  for (uint32_t i=0; i < n; i++) {
+    p[i] = generate ? float_to_int16(32767.0f * gain[i]) : (int16_t)(p[i] * gain[i]);
+  }
+}
+
+static inline void env_apply_ramp8_f32(int16_t *p, float gain, float inc, bool generate)
+{
+  for (int i=0; i < 8; i++) {
+    gain += inc;
+    p[i] = generate ? float_to_int16(32767.0f * gain) : (int16_t)(p[i] * gain);
+  }
+}
+
+// Exponential envelope: how many of the next n samples keep ysum where it
+// is, advancing the state machine over them exactly as the per sample
+// steps would. 0 when ysum moves on the next sample.
+uint32_t AudioEffectEnvelopeTS::exp_constant_run(uint32_t n)
+{
+  uint32_t run;
+
+  switch(state)
+  {
+    case STATE_IDLE_NEXT:
+      return n;
+
+    case STATE_DELAY:
+    case STATE_HOLD:
+      // Both count exp_count down to zero and move on in that sample
+      run = exp_count + 1;
+      if (run == 0 || run > n) run = n;
+      if (run == exp_count + 1) {
+        if (state == STATE_DELAY) {
+          state=STATE_ATTACK;
+        } else {
+          state=STATE_DECAY;
+          exp_count=((uint32_t)coefs->delay_count)*8 + run;
+        }
+      }
+      exp_count -= run;
+      return run;
+
+    case STATE_SUSTAIN:
+      // Settled once the filter step no longer changes it
+      if (EXP_ENV_FILT2(coefs->decay_k,ysum,sustain_mult) == ysum) return n;
+      return 0;
+
+    case STATE_SUSTAIN_FAST_CHANGE:
+      if (EXP_ENV_FILT2(FAST_SUSTAIN_K1,ysum,sustain_mult) == ysum) return n;
+      return 0;
+
+    default:
+      return 0;
+  }
+}
+
+// One sample of the exponential envelope state machine, returns the gain
+inline int32_t AudioEffectEnvelopeTS::exp_step()
+{
+  switch(state)
+  {
+    case STATE_IDLE:
+      // Since delay counts may not necessarily start at aligned boundaries of 8 samples,
+      // the loop count has to be multiplied by 8
+      // and counted down in the for loop, not in the while loop.
+      exp_count=((uint32_t)(coefs->delay_count))*8;
+      ysum=0;
+      state=STATE_IDLE_NEXT; // Do this so reinitialization is only done once at every idle state.
+      // Falls through to STATE_IDLE_NEXT
+
+    case STATE_IDLE_NEXT:
+      break; //ysum is zero here
+
+    case STATE_DELAY:
+      if(exp_count--) break; // ysum is zero here
+      state=STATE_ATTACK;
+      break;
+
+    case STATE_ATTACK:
+      ysum=EXP_ENV_FILT1(coefs->attack_k,ysum,coefs->attack_target);
+      if(ysum>=EXP_ENV_ONE)
+      {   // The maximum 32 bit value of the envelope has been reached.
+        ysum=EXP_ENV_ONE;
+        if(coefs->hold_count)
+        {
+          exp_count=((uint32_t)coefs->hold_count)*8;
+          state=STATE_HOLD;
+        }
+        else
+        {
+          state=STATE_DECAY;
+          exp_count=((uint32_t)coefs->delay_count)*8; // Only used to arbitrarioly define where sustain begins.
+        }
+      }
+      break;
+
+    case STATE_HOLD:
+      if((exp_count--)==0)
+      {
+         state=STATE_DECAY; // ysum is maximum here (ENV_MAX_32).
+         exp_count=((uint32_t)coefs->delay_count)*8;
+      }
+      break;
+
+    case STATE_DECAY:
+      if((exp_count--)==0) state=STATE_SUSTAIN;
+      // Sustain is only needed to support isRelease(). This happens after delay_count is decremented to zero.
+      // The point at which sustain begins after the start of decay is arbitrary on an exponential curve
+      // Here it occurs after one time constant (delay_count*8) which is 63.2% down the decay curve.
+      ysum=EXP_ENV_FILT2(coefs->decay_k,ysum,sustain_mult);
+      break;
+
+    case STATE_SUSTAIN: // Gets here from decay when delay count is zero. Used to flag when sustain begins.
+      ysum=EXP_ENV_FILT2(coefs->decay_k,ysum,sustain_mult);
+      break;
+
+    case STATE_SUSTAIN_FAST_CHANGE: // Only gets here when sustain is changed while in decay or any sustain states.
+      ysum=EXP_ENV_FILT2(FAST_SUSTAIN_K1,ysum,sustain_mult);
+      break;
+
+    case STATE_RELEASE:
+      ysum=EXP_ENV_FILT2(coefs->release_k,ysum,-RELEASE_BIAS);
+      if(ysum<0) ysum=0;
+      // Bias added to end release a bit sooner. Value must be checked for underflow since unsigned integers are used.
+      // This has affects the longest release settings the most since it is not scaled with the release time constant.
+      if(YSUM2MULT(ysum)==0) // All of the useful bits are zero so no reason to stay in this state.
+        state=STATE_IDLE;
+      break;
+
+    case STATE_FORCED:
+      ysum=EXP_ENV_FILT2(coefs->release_forced_k,ysum,-FORCED_RELEASE_BIAS);
+      if(YSUM2MULT(ysum)<=0)
+      {
+        state=STATE_ATTACK;// revert to IDLE state when useful bits are zero.
+        ysum=0;
+      }
+    default:
+      break;
+  }
+  return YSUM2MULT(ysum);
+}
+
+// The linear envelope steps in 8 sample groups and expects whole ones
+static_assert(AUDIO_BLOCK_SAMPLES % 8 == 0, "AUDIO_BLOCK_SAMPLES must be a multiple of 8");
+
+FASTRUN void AudioEffectEnvelopeTS::update(void)
+{
+  audio_block_t *block;
+  int16_t *p, *end;
+  uint32_t n;
+  bool constant;
+
+  if (generator_mode) {
+    if (state == STATE_IDLE) return;
+    block = allocate();
+    if (!block) return;
+    constant = true;
+  } else {
+    block = receiveWritable();
+    if (!block) return;
+    if (state == STATE_IDLE) {
+      AudioBlockTags::release(block);
+      return;
+    }
+    constant = AudioBlockTags::isConstant(block);
+  }
+  p = block->data;
+  end = p + AUDIO_BLOCK_SAMPLES;
+  if(coefs->env_type==-128)
   { // Original AudioEffectEnvelope class linear envelope.
+    // count is in 8 sample groups and the block is a whole number of them,
+    // so each pass runs to the next state change or the end of the block
     while (p < end) {
       // we only care about the state when completing a region
       if (count == 0) {
         if (state == STATE_ATTACK) {
-          count = hold_count;
+          count = coefs->hold_count;
           if (count > 0) {
             state = STATE_HOLD;
             mult_hires = 0x40000000;
             inc_hires = 0;
           } else {
             state = STATE_DECAY;
-            count = decay_count;
+            count = coefs->decay_count;
             inc_hires = (sustain_mult - 0x40000000) / (int32_t)count;
           }
           continue;
         } else if (state == STATE_HOLD) {
           state = STATE_DECAY;
-          count = decay_count;
+          count = coefs->decay_count;
           inc_hires = (sustain_mult - 0x40000000) / (int32_t)count;
           continue;
         } else if (state == STATE_DECAY) {
@@ -144,190 +542,103 @@ void AudioEffectEnvelopeTS::update(void)
           count = 0xFFFF;
         } else if (state == STATE_RELEASE) {
           state = STATE_IDLE;
-          while (p < end) {
-            *p++ = 0;
-            *p++ = 0;
-            *p++ = 0;
-            *p++ = 0;
-          }
+          memset(p, 0, (end - p) * sizeof(int16_t));
           break;
         } else if (state == STATE_FORCED) {
           mult_hires = 0;
-          count = delay_count;
+          count = coefs->delay_count;
           if (count > 0) {
             state = STATE_DELAY;
             inc_hires = 0;
           } else {
             state = STATE_ATTACK;
-            count = attack_count;
+            count = coefs->attack_count;
             inc_hires = 0x40000000 / (int32_t)count;
           }
         } else if (state == STATE_DELAY) {
           state = STATE_ATTACK;
-          count = attack_count;
+          count = coefs->attack_count;
           inc_hires = 0x40000000 / count;
           continue;
         }
         else
         {
           state=STATE_IDLE; // If in some unused state switching back into linear mode, set to known state that linear mode uses.
-          count=delay_count;
+          count=coefs->delay_count;
         }
       }
 
-      int32_t mult = mult_hires >> 14;
-      int32_t inc = inc_hires >> 17;
+      // Groups until the next state change, at least one (a zero count
+      // here wraps around, as it always has)
+      n = (end - p) >> 3;
+      if (n > count && count > 0) n = count;
+      count -= n;
+      if (inc_hires == 0) {
+        // Sustain, hold and delay: one gain for the whole run
+        if (n * 8 != AUDIO_BLOCK_SAMPLES) constant = false;
+        if (float_mode) env_apply_constant_f32(p, mult_hires * ENV_GAIN_SCALE, n * 8, generator_mode);
+        else env_apply_constant(p, mult_hires >> 14, n * 8, generator_mode);
+        p += n * 8;
+        continue;
+      }
+      constant = false;
+      if (float_mode) {
+        const float inc = inc_hires * (ENV_GAIN_SCALE / 8);
+        do {
+          env_apply_ramp8_f32(p, mult_hires * ENV_GAIN_SCALE, inc, generator_mode);
+          p += 8;
+          mult_hires += inc_hires;
+        } while (--n);
+        continue;
+      }
       // process 8 samples, using only mult and inc (16 bit resolution)
-      sample12 = *p++;
-      sample34 = *p++;
-      sample56 = *p++;
-      sample78 = *p++;
-      p -= 4;
-      mult += inc;
-      tmp1 = signed_multiply_32x16b(mult, sample12);
-      mult += inc;
-      tmp2 = signed_multiply_32x16t(mult, sample12);
-      sample12 = pack_16b_16b(tmp2, tmp1);
-      mult += inc;
-      tmp1 = signed_multiply_32x16b(mult, sample34);
-      mult += inc;
-      tmp2 = signed_multiply_32x16t(mult, sample34);
-      sample34 = pack_16b_16b(tmp2, tmp1);
-      mult += inc;
-      tmp1 = signed_multiply_32x16b(mult, sample56);
-      mult += inc;
-      tmp2 = signed_multiply_32x16t(mult, sample56);
-      sample56 = pack_16b_16b(tmp2, tmp1);
-      mult += inc;
-      tmp1 = signed_multiply_32x16b(mult, sample78);
-      mult += inc;
-      tmp2 = signed_multiply_32x16t(mult, sample78);
-      sample78 = pack_16b_16b(tmp2, tmp1);
-      *p++ = sample12;
-      *p++ = sample34;
-      *p++ = sample56;
-      *p++ = sample78;
-      // adjust the long-term gain using 30 bit resolution (fix #102)
-      // https://github.com/PaulStoffregen/Audio/issues/102
-      mult_hires += inc_hires;
-      count--;
+      int32_t inc = inc_hires >> 17;
+      do {
+        env_apply_ramp8(p, mult_hires >> 14, inc, generator_mode);
+        p += 8;
+        // adjust the long-term gain using 30 bit resolution (fix #102)
+        // https://github.com/PaulStoffregen/Audio/issues/102
+        mult_hires += inc_hires;
+      } while (--n);
     }
   }
   else  //Exponential ADSR Vince R. Pearson
   {
-    uint16_t i;
-    while (p < end) 
+    int32_t exp_mult[8];
+    float exp_gain[8];
+    while (p < end)
     {
-      for(i=0;i<8;i++)
-      {
-        switch(state)
-        {
-          case STATE_IDLE:
-            // Since delay counts may not necessarily start at aligned boundaries of 8 samples,
-            // the loop count has to be multiplied by 8
-            // and counted down in the for loop, not in the while loop.
-            exp_count=((uint32_t)(delay_count))*8;
-            ysum=0;
-            state=STATE_IDLE_NEXT; // Do this so reinitialization is only done once at every idle state.
-            // Falls through to STATE_IDLE_NEXT
-            
-          case STATE_IDLE_NEXT:
-            break; //ysum is zero here
-            
-          case STATE_DELAY:
-            if(exp_count--) break; // ysum is zero here
-            state=STATE_ATTACK;
-            break;
-            
-          case STATE_ATTACK:
-            ysum=EXP_ENV_FILT1(attack_k,ysum,attack_target);
-            if(ysum>=EXP_ENV_ONE)  
-            {   // The maximum 32 bit value of the envelope has been reached.
-              ysum=EXP_ENV_ONE;
-              if(hold_count)
-              {
-                exp_count=((uint32_t)hold_count)*8;
-                state=STATE_HOLD;
-              }
-              else 
-              {
-                state=STATE_DECAY;
-                exp_count=((uint32_t)delay_count)*8; // Only used to arbitrarioly define where sustain begins.
-              }
-            }
-            break;
-            
-          case STATE_HOLD:
-            if((exp_count--)==0) 
-            {
-               state=STATE_DECAY; // ysum is maximum here (ENV_MAX_32).
-               exp_count=((uint32_t)delay_count)*8;
-            }
-            break;
-            
-          case STATE_DECAY:
-            if((exp_count--)==0) state=STATE_SUSTAIN;
-            // Sustain is only needed to support isRelease(). This happens after delay_count is decremented to zero.
-            // The point at which sustain begins after the start of decay is arbitrary on an exponential curve
-            // Here it occurs after one time constant (delay_count*8) which is 63.2% down the decay curve.
-            ysum=EXP_ENV_FILT2(decay_k,ysum,sustain_mult);
-            break;
-            
-          case STATE_SUSTAIN: // Gets here from decay when delay count is zero. Used to flag when sustain begins.
-            ysum=EXP_ENV_FILT2(decay_k,ysum,sustain_mult);
-            break;
-            
-          case STATE_SUSTAIN_FAST_CHANGE: // Only gets here when sustain is changed while in decay or any sustain states.
-            ysum=EXP_ENV_FILT2(FAST_SUSTAIN_K1,ysum,sustain_mult);
-            break;
-            
-          case STATE_RELEASE:
-            ysum=EXP_ENV_FILT2(release_k,ysum,-RELEASE_BIAS);
-            if(ysum<0) ysum=0;
-            // Bias added to end release a bit sooner. Value must be checked for underflow since unsigned integers are used.
-            // This has affects the longest release settings the most since it is not scaled with the release time constant.
-            if(YSUM2MULT(ysum)==0) // All of the useful bits are zero so no reason to stay in this state.
-              state=STATE_IDLE;
-            break;
-            
-          case STATE_FORCED:            
-            ysum=EXP_ENV_FILT2(release_forced_k,ysum,-FORCED_RELEASE_BIAS);
-            if(YSUM2MULT(ysum)<=0)
-            { 
-              state=STATE_ATTACK;// revert to IDLE state when useful bits are zero.
-              ysum=0;
-            }
-          default:
-            break;  
+      // Settled or holding: one gain up to the next state change
+      n = exp_constant_run(end - p);
+      if (n) {
+        if (n != AUDIO_BLOCK_SAMPLES) constant = false;
+        if (float_mode) env_apply_constant_f32(p, ysum * ENV_GAIN_SCALE, n, generator_mode);
+        else env_apply_constant(p, YSUM2MULT(ysum), n, generator_mode);
+        p += n;
+        continue;
+      }
+      // Moving: per sample, 8 at a time (or up to the block end)
+      n = end - p;
+      if (n > 8) n = 8;
+      constant = false;
+      if (float_mode) {
+        for (uint32_t i=0; i < n; i++) {
+          exp_step();
+          exp_gain[i] = ysum * ENV_GAIN_SCALE;
         }
-        exp_mult[i]=YSUM2MULT(ysum);
+        env_apply_f32(p, exp_gain, n, generator_mode);
+      } else {
+        for (uint32_t i=0; i < n; i++) exp_mult[i] = exp_step();
+        env_apply(p, exp_mult, n, generator_mode);
       }
-      // multiply audio samples with 8 envelope samples
-      sample12 = *p++;
-      sample34 = *p++;
-      sample56 = *p++;
-      sample78 = *p++;
-      p -= 4;
-      tmp1 = signed_multiply_32x16b(exp_mult[0], sample12);
-      tmp2 = signed_multiply_32x16t(exp_mult[1], sample12);
-      sample12 = pack_16b_16b(tmp2, tmp1);
-      tmp1 = signed_multiply_32x16b(exp_mult[2], sample34);
-      tmp2 = signed_multiply_32x16t(exp_mult[3], sample34);
-      sample34 = pack_16b_16b(tmp2, tmp1);
-      tmp1 = signed_multiply_32x16b(exp_mult[4], sample56);
-      tmp2 = signed_multiply_32x16t(exp_mult[5], sample56);
-      sample56 = pack_16b_16b(tmp2, tmp1);
-      tmp1 = signed_multiply_32x16b(exp_mult[6], sample78);
-      tmp2 = signed_multiply_32x16t(exp_mult[7], sample78);
-      sample78 = pack_16b_16b(tmp2, tmp1);
-      *p++ = sample12;
-      *p++ = sample34;
-      *p++ = sample56;
-      *p++ = sample78;
+      p += n;
     }
   }
+  // A gain held over the whole block keeps a constant input constant, and
+  // generates one, see block_tags.h
+  AudioBlockTags::tag(block, constant ? AUDIO_BLOCK_TAG_CONSTANT : AUDIO_BLOCK_TAG_NONE);
   transmit(block);
-  release(block);
+  AudioBlockTags::release(block);
 }
 
 bool AudioEffectEnvelopeTS::isActive()
@@ -337,6 +648,13 @@ bool AudioEffectEnvelopeTS::isActive()
   return true;
 }
 
+float AudioEffectEnvelopeTS::getLevel()
+{
+  if (!isActive()) return 0.0f;
+  if (coefs->env_type == -128) return mult_hires * (1.0f / 0x40000000);
+  return ysum * (1.0f / EXP_ENV_ONE);
+}
+
 bool AudioEffectEnvelopeTS::isSustain()
 {
   uint8_t current_state = *(volatile uint8_t *)&state;
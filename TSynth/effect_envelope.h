@@ -30,12 +30,15 @@
 #include "Arduino.h"
 #include "AudioStream.h"
 #include "utility/dspinst.h"
+#include "float_kernels.h"
 
 #define SAMPLES_PER_MSEC (AUDIO_SAMPLE_RATE_EXACT/1000.0)
 #define EXP_ENV_ONE ((int32_t)0x40000000)
 // Envelope type. EXP_Nx are attacks with different amounts of negative curvature. EXP_Px have positive curvature.
 // EXP_0 has a linear attack.
 #define NUM_ENV_TYPES 18 // Linear, Exp -8 through Exp +8
+#define ENV_TABLE_MAX 128 // Entries in the coefficient tables, one per ENVTIMES step
+#define ENV_ATTACK_TABLES 2 // Exp attack curve types with tables, the amp and filter envelope types
 
 // Fast Sustain Time Constant for Exp Envelope
 // Normally changes in sustain level while in sustain are subject to the decay delay setting.
@@ -61,24 +64,93 @@
 // The other stages use y(n+1)=k*(y(n)-target)+target where k=exp(-Ts/To)(normalized).
 
 
-class AudioEffectEnvelopeTS : public AudioStream
+// Times and curve coefficients of an envelope. Envelopes read them through a
+// pointer, so a voice group can point all its envelopes at one set and a
+// parameter change is worked out once rather than per voice.
+// The exp() results for a list of times (the panel's ENVTIMES steps) come
+// from tables filled by buildTables() at boot, and for the attack from the
+// tables buildAttackTables() fills for the curve types in use; any other
+// time or type is computed.
+class AudioEnvelopeCoefsTS
 {
 public:
-    AudioEffectEnvelopeTS() : AudioStream(1, inputQueueArray) {
-    state = 0;
-    env_type=-128; // Added for addition of exponential envelope. Default is linear. -8 through 8 are different amounts of positive and negative curvature.
-    delay(0.0f);  // default values...
+  AudioEnvelopeCoefsTS() {
+    env_type=-128; // Default is linear
+    attack_index=-1;
+    delay(0.0f);
     attack(10.5f);
     hold(2.5f);
     decay(35.0f);
-    sustain(0.5f);
     release(300.0f);
     releaseNoteOn(5.0f);
   }
+  // milliseconds must be sorted ascending and stay valid, at most
+  // ENV_TABLE_MAX entries
+  static void buildTables(const uint16_t *milliseconds, uint8_t n);
+  // Attack tables for up to ENV_ATTACK_TABLES curve types, after
+  // buildTables(). A type already tabled isn't built again. Only coefficients
+  // worked out afterwards use them, so call it before setEnvType().
+  static void buildAttackTables(const int8_t *types, uint8_t n);
+
+  FLASHMEM void delay(float milliseconds) {
+    delay_count = milliseconds2count(milliseconds); // Number of samples is 8 times this number for linear mode.
+  }
+  void attack(float milliseconds);
+  FLASHMEM void hold(float milliseconds) {
+    hold_count = milliseconds2count(milliseconds);
+  }
+  void decay(float milliseconds);
+  void release(float milliseconds);
+  void releaseNoteOn(float milliseconds);
+  void setEnvType(int8_t type);
+  int8_t getEnvType() { return env_type; }
+
+  static uint16_t milliseconds2count(float milliseconds) {
+    if (milliseconds < 0.0) milliseconds = 0.0;
+    uint32_t c = ((uint32_t)(milliseconds*SAMPLES_PER_MSEC)+7)>>3;
+    if (c > 65535) c = 65535; // allow up to 11.88 seconds
+    return c;
+  }
+
+private:
+  friend class AudioEffectEnvelopeTS;
+  void updateExpAttack();
+
+  uint16_t delay_count;
+  uint16_t attack_count;
+  uint16_t hold_count;
+  uint16_t decay_count;
+  uint16_t release_count;
+  uint16_t release_forced_count;
+  int8_t env_type; // Attack curve type. Limit to -8 to 8 integers for exp curve, -128 for linear.
+  int16_t attack_index; // attack time's position in the tables, -1 if not there
+  int32_t attack_k;
+  int32_t attack_target;
+  int32_t decay_k;
+  int32_t release_k;
+  int32_t release_forced_k;
+};
+
+class AudioEffectEnvelopeTS : public AudioStream
+{
+public:
+    AudioEffectEnvelopeTS() : AudioStream(1, inputQueueArray) {
+    state = 0;
+    coefs = &own_coefs;
+    sustain(0.5f);
+    generator_mode = false;
+    float_mode = FLOAT_ENVELOPE;
+  }
   void noteOn();
   void noteOff();
+  // Read times and curves from a set shared with other envelopes, NULL to
+  // go back to this envelope's own. The setters below then change the
+  // shared set.
+  void useCoefs(AudioEnvelopeCoefsTS *shared) {
+    coefs = shared ? shared : &own_coefs;
+  }
   FLASHMEM void delay(float milliseconds) {
-    delay_count = milliseconds2count(milliseconds); // Number of samples is 8 times this number for linear mode.
+    coefs->delay(milliseconds);
     __disable_irq();
     if(state==STATE_IDLE_NEXT) state=STATE_IDLE; // Force counter reload if in STATE_IDLE_NEXT.
     __enable_irq();
@@ -97,25 +169,18 @@ public:
 
   FLASHMEM void setEnvType(int8_t type)
   {
-    env_type=type;
-    updateExpAttack(); // Exponential attack parameters need updating.
+    coefs->setEnvType(type);
   }
-  FLASHMEM int8_t getEnvType() { return env_type;};
+  FLASHMEM int8_t getEnvType() { return coefs->env_type;};
 
- 
   FLASHMEM void attack(float milliseconds) {
-    attack_count = milliseconds2count(milliseconds);
-    if(attack_count==0) attack_count=1; //************* added check for div/0
-    updateExpAttack();
+    coefs->attack(milliseconds);
   }
-
   FLASHMEM void hold(float milliseconds) {
-    hold_count = milliseconds2count(milliseconds);
+    coefs->hold(milliseconds);
   }
   FLASHMEM void decay(float milliseconds) {
-    decay_count = milliseconds2count(milliseconds);
-    if (decay_count == 0) decay_count = 1;
-    updateExpDecay();
+    coefs->decay(milliseconds);
   }
   FLASHMEM void sustain(float level) {
     if (level < 0.0) level = 0;
@@ -128,13 +193,10 @@ public:
     __enable_irq();
   }
   FLASHMEM void release(float milliseconds) {
-    release_count = milliseconds2count(milliseconds);
-    if (release_count == 0) release_count = 1;
-    updateExpRelease();
+    coefs->release(milliseconds);
   }
   FLASHMEM void releaseNoteOn(float milliseconds) {
-    release_forced_count = milliseconds2count(milliseconds);
-    updateExpReleaseNoteOn();
+    coefs->releaseNoteOn(milliseconds);
   }
  //ElectroTechnique 2020 - close the envelope to silence it
 FLASHMEM void close(){
@@ -147,62 +209,28 @@ FLASHMEM void close(){
 }
   bool isActive();
   bool isSustain();
+  // Current envelope gain, 0.0 to 1.0, as of the last update. Cheap enough
+  // to poll from voice allocation or metering.
+  float getLevel();
+  // Generator mode: no input, the envelope itself is the output, the same
+  // as an input of constant full scale DC without receiving or multiplying
+  // a block.
+  FLASHMEM void generator(bool enable) {
+    generator_mode = enable;
+  }
+  // Apply the gain in float32 from the full resolution envelope rather
+  // than as 16.16 fixed point, see float_kernels.h. The envelope itself
+  // runs the same either way.
+  FLASHMEM void useFloat(bool enable) {
+    float_mode = enable;
+  }
   using AudioStream::release;
   virtual void update(void);
-  void setEnvType(uint8_t type);
 
 private:
-  uint16_t milliseconds2count(float milliseconds) {
-    if (milliseconds < 0.0) milliseconds = 0.0;
-    uint32_t c = ((uint32_t)(milliseconds*SAMPLES_PER_MSEC)+7)>>3;
-    if (c > 65535) c = 65535; // allow up to 11.88 seconds
-    return c;
-  }
-  FLASHMEM void updateExpDecay() // needed in case sustain changes.
-  {
-    double k;
-    k=exp(-1.0L/(decay_count*4.0L));
-    decay_k=(uint32_t)(EXP_ENV_ONE*k);
-    //decay_target=(1.0L-k)*sustain_target;
-  }
-  
-  FLASHMEM void updateExpAttack() // This is needed in case env type changes.
-  {
-   double k1,k2; 
-    if(env_type>8 || env_type<-8) return; // Anything outside this range is a linear envelope.
-    if(env_type==0) // Linear attack. Everything else is exponential.
-    {
-      attack_k=EXP_ENV_ONE;
-      attack_target=(uint32_t)(EXP_ENV_ONE/(attack_count*8.0L));
-    }
-    else
-    {
-      k1=exp((double)env_type/(attack_count*8.0L));
-      k2=(k1-1.0L)/(exp((double)env_type)-1.0L);
-      attack_k=(uint32_t)(EXP_ENV_ONE*k1);
-      attack_target=(uint32_t)(EXP_ENV_ONE*k2);
-    }
-  }
-
-  FLASHMEM void updateExpRelease()
-  {
-    double k;
-    k=exp(-1.0L/(release_count*4.0L));
-    release_k=(uint32_t)(EXP_ENV_ONE*k);
-  }
-
-  FLASHMEM void updateExpReleaseNoteOn()
-  {
-    double k;
-    // Increased forced release rate x4 so it will end before the next note off call.
-    // Unlike linear mode this time is dependant on sustain level and release rate. It may be better to implement this state as a linear ramp with a fixed time
-    // for consistent behaviour. 
-    k=exp(-4.0L/(release_forced_count*8.0L));
-    release_forced_k=(uint32_t)(EXP_ENV_ONE*k);
-  }
-
+  uint32_t exp_constant_run(uint32_t n);
+  int32_t exp_step();
   audio_block_t *inputQueueArray[1];
-  static const uint8_t env_type_values[NUM_ENV_TYPES];
   // state
   uint8_t  state;      // idle, delay, attack, hold, decay, sustain, release, forced (now idle_next)
   uint16_t count;      // how much time remains in this state, in 8 sample units
@@ -210,13 +238,9 @@ private:
   int32_t  inc_hires;  // amount to change mult_hires every 8 samples
 
   // settings
-  uint16_t delay_count;
-  uint16_t attack_count;
-  uint16_t hold_count;
-  uint16_t decay_count;
+  AudioEnvelopeCoefsTS *coefs;
+  AudioEnvelopeCoefsTS own_coefs;
   int32_t  sustain_mult; // Shared with exponential envelope generator.
-  uint16_t release_count;
-  uint16_t release_forced_count;
 
 
   enum { // Make this a private class enum set instead of using defines.
@@ -232,14 +256,10 @@ private:
     STATE_IDLE_NEXT,  // Not used for original linear envelope.
     };
  // Exponential ADSR variables
-  int8_t env_type; // Attack curve type. Limit to -8 to 8 integers for exp curve, -128 for linear.
   uint32_t exp_count; // same function as count in linear generator but for single samples, not groups of 8.
   int32_t ysum;
-  int32_t attack_k;
-  int32_t attack_target;
-  int32_t decay_k;
-  int32_t release_k;
-  int32_t release_forced_k;
+  bool generator_mode;
+  bool float_mode;
 };
 
 #undef SAMPLES_PER_MSEC
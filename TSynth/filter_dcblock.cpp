@@ -0,0 +1,58 @@
+/* Audio Library for Teensy 3.X
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "filter_dcblock.h"
+#include "utility/dspinst.h"
+
+// fractional bits of the output state
+#define DCBLOCK_FRAC 12
+
+FASTRUN void AudioFilterDCBlockTS::update(void)
+{
+	audio_block_t *block;
+	int16_t *p, *end;
+	int32_t x, xprev, y, leak;
+
+	block = receiveWritable(0);
+	if (!block) {
+		// Nothing is transmitted either, so start again from rest rather
+		// than step from where the last sound left off
+		state_inputprev = 0;
+		state_output = 0;
+		return;
+	}
+	leak = setting_leak;
+	xprev = state_inputprev;
+	y = state_output;
+	p = block->data;
+	end = p + AUDIO_BLOCK_SAMPLES;
+	do {
+		x = *p;
+		y += ((x - xprev) << DCBLOCK_FRAC) - multiply_32x32_rshift32_rounded(y, leak);
+		xprev = x;
+		*p++ = signed_saturate_rshift(y + (1 << (DCBLOCK_FRAC - 1)), 16, DCBLOCK_FRAC);
+	} while (p < end);
+	state_inputprev = xprev;
+	state_output = y;
+	transmit(block);
+	release(block);
+}
@@ -0,0 +1,60 @@
+/* Audio Library for Teensy 3.X
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// DC blocker: one pole, one zero highpass
+//   y[n] = x[n] - x[n-1] + R y[n-1]
+// with the pole R = exp(-2 pi fc / fs), so the corner sits at fc.
+//
+// y is kept with 12 fractional bits and the leak (1 - R) y is rounded, so
+// the output settles to zero rather than to a truncation offset. Input 0 is
+// processed in place and there is a single output, the highpass.
+
+#ifndef filter_dcblock_h_
+#define filter_dcblock_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+
+class AudioFilterDCBlockTS: public AudioStream
+{
+public:
+	AudioFilterDCBlockTS() : AudioStream(1, inputQueueArray) {
+		frequency(12.0);
+		state_inputprev = 0;
+		state_output = 0;
+	}
+	// Corner frequency in Hz
+	void frequency(float freq) {
+		if (freq < 1.0) freq = 1.0;
+		else if (freq > 1000.0) freq = 1000.0;
+		// 1 - R, scaled by 2^32
+		setting_leak = (1.0f - expf(-2.0f * 3.141592654f * freq / AUDIO_SAMPLE_RATE_EXACT))
+			* 4294967296.0f;
+	}
+	virtual void update(void);
+private:
+	int32_t setting_leak;
+	int32_t state_inputprev;
+	int32_t state_output;
+	audio_block_t *inputQueueArray[1];
+};
+
+#endif
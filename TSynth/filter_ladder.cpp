@@ -0,0 +1,167 @@
+/* Audio Library for Teensy 3.X
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include <math.h>
+#include "filter_ladder.h"
+#include "block_tags.h"
+
+// Highest corner frequency as a fraction of the (possibly oversampled)
+// sample rate, keeps tan() away from its pole
+#define LADDER_MAX_FC 0.45f
+
+// tanh substitute: x - x^3/6.75, which reaches +/-1 with zero slope at
+// +/-1.5 and is held there. Cheaper than tanhf() by far and close enough
+// for the input stage, where only the soft overload character matters.
+static inline float ladder_saturate(float x)
+{
+	if (x > 1.5f) return 1.0f;
+	if (x < -1.5f) return -1.0f;
+	return x - x * x * x * (1.0f / 6.75f);
+}
+
+static inline int16_t ladder_output(float y)
+{
+	int32_t n = (int32_t)(y * 32768.0f);
+	if (n > 32767) return 32767;
+	if (n < -32768) return -32768;
+	return n;
+}
+
+// Each stage is a trapezoidal one pole lowpass, v = (x - s)G, y = v + s,
+// s' = y + v, so y = Gx + (1-G)s. Chained four times and closed with
+// feedback u = x - k*y4, the output is linear in x and the states:
+//   y4 = (G^4 x + G^3(1-G)s0 + G^2(1-G)s1 + G(1-G)s2 + (1-G)s3) / (1 + kG^4)
+// which is what lets the loop run without a unit delay.
+void AudioFilterLadderTS::compute_coefs(float control, Coefs &c)
+{
+	const float fs = oversampling ? 2.0f * AUDIO_SAMPLE_RATE_EXACT : AUDIO_SAMPLE_RATE_EXACT;
+	float fc = setting_fcenter * exp2f(control * setting_octavemult);
+	if (fc > LADDER_MAX_FC * fs) fc = LADDER_MAX_FC * fs;
+	const float g = tanf((float)M_PI * fc / fs);
+	const float G = g / (1.0f + g);
+	const float G2 = G * G;
+	const float norm = 1.0f / (1.0f + setting_k * G2 * G2);
+	const float H = (1.0f - G) * norm;
+	c.g = G;
+	c.sx = G2 * G2 * norm;
+	c.s[0] = G2 * G * H;
+	c.s[1] = G2 * H;
+	c.s[2] = G * H;
+	c.s[3] = H;
+}
+
+// One pass through the ladder at the current coefficients. The solve above
+// is for the linear ladder, the saturator isn't in it: y4 is predicted
+// from the unsaturated input, then the stages run on the saturated u, so
+// they only land on the prediction while the saturator is near linear,
+// |x - k*y| well under 1. Driven harder, the feedback taken off is that
+// of the unsaturated ladder, a little more than the stages go on to give.
+// Solving the saturated loop would take an iteration per sample; this
+// keeps the ladder near the cost of the state variable filter.
+#define LADDER_STEP(x, y) do { \
+		float u, v; \
+		y = c.sx * (x) + c.s[0] * s0 + c.s[1] * s1 + c.s[2] * s2 + c.s[3] * s3; \
+		u = ladder_saturate((x) - k * y); \
+		v = (u - s0) * c.g; y = v + s0; s0 = y + v; \
+		v = (y - s1) * c.g; y = v + s1; s1 = y + v; \
+		v = (y - s2) * c.g; y = v + s2; s2 = y + v; \
+		v = (y - s3) * c.g; y = v + s3; s3 = y + v; \
+	} while (0)
+
+FASTRUN void AudioFilterLadderTS::update(void)
+{
+	audio_block_t *input_block=NULL, *control_block=NULL, *output_block;
+	Coefs target, delta, c;
+	float s0, s1, s2, s3, k, x, xprev, y, y2;
+	const int16_t *in;
+	int16_t *out, *end;
+
+	// Processed in place, each sample is read before it's replaced
+	input_block = receiveWritable(0);
+	control_block = receiveReadOnly(1);
+	if (!input_block) {
+		if (control_block) AudioBlockTags::release(control_block);
+		return;
+	}
+	AudioBlockTags::tag(input_block, AUDIO_BLOCK_TAG_NONE);
+	output_block = input_block;
+
+	// Coefficients for the end of this block, from the last control
+	// sample; the ramp towards them starts where the last block ended
+	if (control_block) {
+		compute_coefs(control_block->data[AUDIO_BLOCK_SAMPLES-1] * (1.0f / 32768.0f), target);
+		AudioBlockTags::release(control_block);
+	} else {
+		compute_coefs(0.0f, target);
+	}
+	if (!coefs_valid) {
+		coefs = target;
+		coefs_valid = true;
+	}
+	c = coefs;
+	delta.g = (target.g - c.g) * (1.0f / AUDIO_BLOCK_SAMPLES);
+	delta.sx = (target.sx - c.sx) * (1.0f / AUDIO_BLOCK_SAMPLES);
+	for (int i=0; i < 4; i++) {
+		delta.s[i] = (target.s[i] - c.s[i]) * (1.0f / AUDIO_BLOCK_SAMPLES);
+	}
+
+	k = setting_k;
+	s0 = state[0];
+	s1 = state[1];
+	s2 = state[2];
+	s3 = state[3];
+	xprev = inputprev;
+	in = input_block->data;
+	out = output_block->data;
+	end = out + AUDIO_BLOCK_SAMPLES;
+	do {
+		c.g += delta.g;
+		c.sx += delta.sx;
+		c.s[0] += delta.s[0];
+		c.s[1] += delta.s[1];
+		c.s[2] += delta.s[2];
+		c.s[3] += delta.s[3];
+		x = (*in++) * (1.0f / 32768.0f);
+		if (oversampling) {
+			// Linear interpolation up, average of both outputs down
+			LADDER_STEP((x + xprev) * 0.5f, y2);
+			LADDER_STEP(x, y);
+			y = (y + y2) * 0.5f;
+		} else {
+			LADDER_STEP(x, y);
+		}
+		// Kept at single rate too, so switching oversampling on
+		// doesn't interpolate from a stale input
+		xprev = x;
+		*out++ = ladder_output(y);
+	} while (out < end);
+	state[0] = s0;
+	state[1] = s1;
+	state[2] = s2;
+	state[3] = s3;
+	inputprev = xprev;
+	// Land exactly on the target, the ramp accumulates rounding
+	coefs = target;
+
+	transmit(output_block);
+	release(output_block);
+}
@@ -0,0 +1,102 @@
+/* Audio Library for Teensy 3.X
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// 4 pole (24dB/oct) lowpass ladder, zero delay feedback (topology preserving
+// transform) form after V. Zavalishin, "The Art of VA Filter Design".
+// Single precision float for the Cortex-M7 FPU.
+//
+// Inputs and controls match AudioFilterStateVariableTS so it can take its
+// place in a voice: input 0 is audio, input 1 is the same octave control
+// signal, and frequency()/resonance()/octaveControl() take the same ranges.
+// Output 0 is lowpass.
+//
+// The feedback path is solved linearly each sample, then the input stage is
+// saturated with a cubic tanh substitute. Coefficients are computed once per
+// block from the last control sample and ramped across the block.
+//
+// Cost per voice is visible at run time through processorUsageMax(), which
+// CPUMonitor() prints next to the state variable filter's.
+
+#ifndef filter_ladder_h_
+#define filter_ladder_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+
+class AudioFilterLadderTS: public AudioStream
+{
+public:
+	AudioFilterLadderTS() : AudioStream(2, inputQueueArray) {
+		oversampling = false;
+		frequency(1000);
+		octaveControl(1.0);
+		resonance(0.707);
+		for (int i=0; i < 4; i++) state[i] = 0;
+		inputprev = 0;
+		coefs_valid = false;
+	}
+	void frequency(float freq) {
+		if (freq < 1.0) freq = 1.0;
+		else if (freq > AUDIO_SAMPLE_RATE_EXACT/2.5) freq = AUDIO_SAMPLE_RATE_EXACT/2.5;
+		setting_fcenter = freq;
+	}
+	// Same 0.7 - 15 range as the state variable filter, 15 is just short of
+	// self oscillation
+	void resonance(float q) {
+		if (q < 0.7) q = 0.7;
+		else if (q > 15.0) q = 15.0;
+		setting_k = (q - 0.7f) * (3.95f / 14.3f);
+	}
+	void octaveControl(float n) {
+		// filter's corner frequency is Fcenter * 2^(control * N)
+		// where "control" ranges from -1.0 to +1.0
+		// and "N" allows the frequency to change from 0 to 7 octaves
+		if (n < 0.0) n = 0.0;
+		else if (n > 6.9999) n = 6.9999;
+		setting_octavemult = n;
+	}
+	// Run the ladder at twice the sample rate: less cutoff warping and
+	// aliasing from the saturator near the top of the range, double the cost
+	void oversample(bool enable) {
+		oversampling = enable;
+		coefs_valid = false;
+	}
+	virtual void update(void);
+private:
+	// per-sample coefficients, linearly ramped between blocks
+	struct Coefs {
+		float g;       // one pole gain G = g/(1+g)
+		float sx;      // input contribution to the predicted output
+		float s[4];    // state contributions to the predicted output
+	};
+	void compute_coefs(float control, Coefs &c);
+	float setting_fcenter;
+	float setting_octavemult;
+	float setting_k;
+	float state[4];
+	float inputprev;
+	Coefs coefs;
+	bool coefs_valid;
+	bool oversampling;
+	audio_block_t *inputQueueArray[2];
+};
+
+#endif
@@ -26,6 +26,7 @@
 
 #include <Arduino.h>
 #include "filter_variable.h"
+#include "block_tags.h"
 #include "utility/dspinst.h"
 
 // State Variable Filter (Chamberlin) with 2X oversampling
@@ -48,174 +49,433 @@
 
 #if defined(__ARM_ARCH_7EM__)
 
-void AudioFilterStateVariableTS::update_fixed(const int16_t *in,
+// log2 of the oversampling factor, and the shift that keeps four summed
+// steps in range
+#define SVF_OS_SHIFT (OVERSAMPLE >> 1)
+#define SVF_SUM_SHIFT (OVERSAMPLE >> 2)
+
+// One input sample through the filter, OVERSAMPLE steps of it with the
+// input ramped from the previous sample and the outputs averaged, using
+// the current fmult. MIXED and OVERSAMPLE are template parameters, so the
+// unused paths compile away and the steps unroll.
+#define SVF_SAMPLE() do { \
+		input = (*in++) << 12; \
+		lowpasstmp = bandpasstmp = highpasstmp = 0; \
+		for (int step = 1; step <= OVERSAMPLE; step++) { \
+			lowpass = lowpass + MULT(fmult, bandpass); \
+			highpass = inputprev + (((input - inputprev) * step) >> SVF_OS_SHIFT) - \
+				lowpass - MULT(damp, bandpass); \
+			bandpass = bandpass + MULT(fmult, highpass); \
+			lowpasstmp += lowpass >> SVF_SUM_SHIFT; \
+			bandpasstmp += bandpass >> SVF_SUM_SHIFT; \
+			highpasstmp += highpass >> SVF_SUM_SHIFT; \
+		} \
+		inputprev = input; \
+		lowpasstmp = signed_saturate_rshift(lowpasstmp, 16, 12 + SVF_OS_SHIFT - SVF_SUM_SHIFT); \
+		bandpasstmp = signed_saturate_rshift(bandpasstmp, 16, 12 + SVF_OS_SHIFT - SVF_SUM_SHIFT); \
+		highpasstmp = signed_saturate_rshift(highpasstmp, 16, 12 + SVF_OS_SHIFT - SVF_SUM_SHIFT); \
+		if (MIXED) { \
+			*lp++ = signed_saturate_rshift( \
+				signed_multiply_32x16b(mixlp, lowpasstmp) + \
+				signed_multiply_32x16b(mixbp, bandpasstmp) + \
+				signed_multiply_32x16b(mixhp, highpasstmp), 16, 0); \
+		} else { \
+			*lp++ = lowpasstmp; \
+			*bp++ = bandpasstmp; \
+			*hp++ = highpasstmp; \
+		} \
+	} while (0)
+
+// Locals the MIXED path reads
+#define SVF_MIX_GAINS() \
+	const int32_t mixlp = setting_mixlp; \
+	const int32_t mixbp = setting_mixbp; \
+	const int32_t mixhp = setting_mixhp
+
+// fmult is worked out for 2x oversampling, 2*sin(pi*f/(2*fs)) in Q30.
+// Twice or half that is the coefficient for 1x or 4x, close enough below
+// the top octave. At 1x the corner stops at fs/6, where the filter is
+// still stable at full resonance.
+template <int OVERSAMPLE>
+static inline int32_t oversampled_fmult(int32_t fmult)
+{
+	if (OVERSAMPLE == 1) return fmult > (1 << 29) ? (1 << 30) : fmult << 1;
+	if (OVERSAMPLE == 4) return fmult >> 1;
+	return fmult;
+}
+
+template <bool MIXED, int OVERSAMPLE>
+FASTRUN void AudioFilterStateVariableTS::update_fixed(const int16_t *in, int32_t coef,
 	int16_t *lp, int16_t *bp, int16_t *hp)
 {
 	const int16_t *end = in + AUDIO_BLOCK_SAMPLES;
 	int32_t input, inputprev;
 	int32_t lowpass, bandpass, highpass;
 	int32_t lowpasstmp, bandpasstmp, highpasstmp;
-	int32_t fmult, damp;
+	const int32_t fmult = oversampled_fmult<OVERSAMPLE>(coef);
+	int32_t damp;
+
+	SVF_MIX_GAINS();
 
-	fmult = setting_fmult;
 	damp = setting_damp;
 	inputprev = state_inputprev;
 	lowpass = state_lowpass;
 	bandpass = state_bandpass;
 	do {
-		input = (*in++) << 12;
-		lowpass = lowpass + MULT(fmult, bandpass);
-		highpass = ((input + inputprev)>>1) - lowpass - MULT(damp, bandpass);
-		inputprev = input;
-		bandpass = bandpass + MULT(fmult, highpass);
-		lowpasstmp = lowpass;
-		bandpasstmp = bandpass;
-		highpasstmp = highpass;
-		lowpass = lowpass + MULT(fmult, bandpass);
-		highpass = input - lowpass - MULT(damp, bandpass);
-		bandpass = bandpass + MULT(fmult, highpass);
-		lowpasstmp = signed_saturate_rshift(lowpass+lowpasstmp, 16, 13);
-		bandpasstmp = signed_saturate_rshift(bandpass+bandpasstmp, 16, 13);
-		highpasstmp = signed_saturate_rshift(highpass+highpasstmp, 16, 13);
-		*lp++ = lowpasstmp;
-		*bp++ = bandpasstmp;
-		*hp++ = highpasstmp;
+		SVF_SAMPLE();
 	} while (in < end);
 	state_inputprev = inputprev;
 	state_lowpass = lowpass;
 	state_bandpass = bandpass;
+	state_fmult = coef;
 }
 
+// compute fmult using control input, fcenter and octavemult
+inline int32_t AudioFilterStateVariableTS::control_fmult(int32_t control)
+{
+	int32_t n, fmult;
+
+	control *= setting_octavemult; // octavemult range: 0 to 28671 (12 frac bits)
+	n = control & 0x7FFFFFF;   // 27 fractional control bits
+	#ifdef IMPROVE_EXPONENTIAL_ACCURACY
+	// exp2 polynomial suggested by Stefan Stenzel on "music-dsp"
+	// mail list, Wed, 3 Sep 2014 10:08:55 +0200
+	int32_t x = n << 3;
+	n = multiply_accumulate_32x32_rshift32_rounded(536870912, x, 1494202713);
+	int32_t sq = multiply_32x32_rshift32_rounded(x, x);
+	n = multiply_accumulate_32x32_rshift32_rounded(n, sq, 1934101615);
+	n = n + (multiply_32x32_rshift32_rounded(sq,
+		multiply_32x32_rshift32_rounded(x, 1358044250)) << 1);
+	n = n << 1;
+	#else
+	// exp2 algorithm by Laurent de Soras
+	// https://www.musicdsp.org/en/latest/Other/106-fast-exp2-approximation.html
+	n = (n + 134217728) << 3;
+	n = multiply_32x32_rshift32_rounded(n, n);
+	n = multiply_32x32_rshift32_rounded(n, 715827883) << 3;
+	n = n + 715827882;
+	#endif
+	n = n >> (6 - (control >> 27)); // 4 integer control bits
+	fmult = multiply_32x32_rshift32_rounded(setting_fcenter, n);
+	//if (fmult > 5378279) fmult = 5378279;
+	if (fmult > 4205728) fmult = 4205728;
+	fmult = fmult << 8;
+	// fmult is within 0.4% accuracy for all but the top 2 octaves
+	// of the audio band.  This math improves accuracy above 5 kHz.
+	// Without this, the filter still works fine for processing
+	// high frequencies, but the filter's corner frequency response
+	// can end up about 6% higher than requested.
+	#ifdef IMPROVE_HIGH_FREQUENCY_ACCURACY
+	// From "Fast Polynomial Approximations to Sine and Cosine"
+	// Charles K Garrett, http://krisgarrett.net/
+	fmult = (multiply_32x32_rshift32_rounded(fmult, 2145892402) +
+		multiply_32x32_rshift32_rounded(
+		multiply_32x32_rshift32_rounded(fmult, fmult),
+		multiply_32x32_rshift32_rounded(fmult, -1383276101))) << 1;
+	#endif
+	return fmult;
+}
 
-void AudioFilterStateVariableTS::update_variable(const int16_t *in,
+template <bool MIXED, int OVERSAMPLE>
+FASTRUN void AudioFilterStateVariableTS::update_variable(const int16_t *in,
 	const int16_t *ctl, int16_t *lp, int16_t *bp, int16_t *hp)
 {
 	const int16_t *end = in + AUDIO_BLOCK_SAMPLES;
-	int32_t input, inputprev, control;
+	int32_t input, inputprev;
 	int32_t lowpass, bandpass, highpass;
 	int32_t lowpasstmp, bandpasstmp, highpasstmp;
-	int32_t fcenter, fmult, damp, octavemult;
-	int32_t n;
+	int32_t coef, fmult, damp;
+
+	SVF_MIX_GAINS();
 
-	fcenter = setting_fcenter;
-	octavemult = setting_octavemult;
 	damp = setting_damp;
 	inputprev = state_inputprev;
 	lowpass = state_lowpass;
 	bandpass = state_bandpass;
 	do {
-		// compute fmult using control input, fcenter and octavemult
-		control = *ctl++;          // signal is always 15 fractional bits
-		control *= octavemult;     // octavemult range: 0 to 28671 (12 frac bits)
-		n = control & 0x7FFFFFF;   // 27 fractional control bits
-		#ifdef IMPROVE_EXPONENTIAL_ACCURACY
-		// exp2 polynomial suggested by Stefan Stenzel on "music-dsp"
-		// mail list, Wed, 3 Sep 2014 10:08:55 +0200
-		int32_t x = n << 3;
-		n = multiply_accumulate_32x32_rshift32_rounded(536870912, x, 1494202713);
-		int32_t sq = multiply_32x32_rshift32_rounded(x, x);
-		n = multiply_accumulate_32x32_rshift32_rounded(n, sq, 1934101615);
-		n = n + (multiply_32x32_rshift32_rounded(sq,
-			multiply_32x32_rshift32_rounded(x, 1358044250)) << 1);
-		n = n << 1;
-		#else
-		// exp2 algorithm by Laurent de Soras
-		// https://www.musicdsp.org/en/latest/Other/106-fast-exp2-approximation.html
-		n = (n + 134217728) << 3;
-		n = multiply_32x32_rshift32_rounded(n, n);
-		n = multiply_32x32_rshift32_rounded(n, 715827883) << 3;
-		n = n + 715827882;
-		#endif
-		n = n >> (6 - (control >> 27)); // 4 integer control bits
-		fmult = multiply_32x32_rshift32_rounded(fcenter, n);
-		//if (fmult > 5378279) fmult = 5378279;
-		if (fmult > 4205728) fmult = 4205728;
-		fmult = fmult << 8;
-		// fmult is within 0.4% accuracy for all but the top 2 octaves
-		// of the audio band.  This math improves accuracy above 5 kHz.
-		// Without this, the filter still works fine for processing
-		// high frequencies, but the filter's corner frequency response
-		// can end up about 6% higher than requested.
-		#ifdef IMPROVE_HIGH_FREQUENCY_ACCURACY
-		// From "Fast Polynomial Approximations to Sine and Cosine"
-		// Charles K Garrett, http://krisgarrett.net/
-		fmult = (multiply_32x32_rshift32_rounded(fmult, 2145892402) +
-			multiply_32x32_rshift32_rounded(
-			multiply_32x32_rshift32_rounded(fmult, fmult),
-			multiply_32x32_rshift32_rounded(fmult, -1383276101))) << 1;
-		#endif
+		// signal is always 15 fractional bits
+		coef = control_fmult(*ctl++);
+		fmult = oversampled_fmult<OVERSAMPLE>(coef);
 		// now do the state variable filter as normal, using fmult
-		input = (*in++) << 12;
-		lowpass = lowpass + MULT(fmult, bandpass);
-		highpass = ((input + inputprev)>>1) - lowpass - MULT(damp, bandpass);
-		inputprev = input;
-		bandpass = bandpass + MULT(fmult, highpass);
-		lowpasstmp = lowpass;
-		bandpasstmp = bandpass;
-		highpasstmp = highpass;
-		lowpass = lowpass + MULT(fmult, bandpass);
-		highpass = input - lowpass - MULT(damp, bandpass);
-		bandpass = bandpass + MULT(fmult, highpass);
-		lowpasstmp = signed_saturate_rshift(lowpass+lowpasstmp, 16, 13);
-		bandpasstmp = signed_saturate_rshift(bandpass+bandpasstmp, 16, 13);
-		highpasstmp = signed_saturate_rshift(highpass+highpasstmp, 16, 13);
-		*lp++ = lowpasstmp;
-		*bp++ = bandpasstmp;
-		*hp++ = highpasstmp;
+		SVF_SAMPLE();
+	} while (in < end);
+	state_inputprev = inputprev;
+	state_lowpass = lowpass;
+	state_bandpass = bandpass;
+	state_fmult = coef;
+}
+
+// Control-rate variant: fmult is only evaluated on the last sample of each
+// group of 2^setting_ctlshift samples and ramped linearly from the previous
+// evaluation, so a swept corner frequency stays continuous across blocks
+template <bool MIXED, int OVERSAMPLE>
+FASTRUN void AudioFilterStateVariableTS::update_interpolated(const int16_t *in,
+	const int16_t *ctl, int16_t *lp, int16_t *bp, int16_t *hp)
+{
+	const int16_t *end = in + AUDIO_BLOCK_SAMPLES;
+	const uint32_t shift = setting_ctlshift;
+	const uint32_t step = 1 << shift;
+	int32_t input, inputprev;
+	int32_t lowpass, bandpass, highpass;
+	int32_t lowpasstmp, bandpasstmp, highpasstmp;
+	int32_t coef, fmult, target, delta, damp;
+
+	SVF_MIX_GAINS();
+
+	damp = setting_damp;
+	inputprev = state_inputprev;
+	lowpass = state_lowpass;
+	bandpass = state_bandpass;
+	coef = state_fmult;
+	fmult = oversampled_fmult<OVERSAMPLE>(coef);
+	do {
+		ctl += step;
+		coef = control_fmult(ctl[-1]);
+		target = oversampled_fmult<OVERSAMPLE>(coef);
+		delta = (target - fmult) >> shift;
+		for (uint32_t i=0; i < step - 1; i++) {
+			fmult += delta;
+			SVF_SAMPLE();
+		}
+		fmult = target;
+		SVF_SAMPLE();
 	} while (in < end);
 	state_inputprev = inputprev;
 	state_lowpass = lowpass;
 	state_bandpass = bandpass;
+	state_fmult = coef;
 }
 
+// The float32 kernels: the same filter in sample units, the coefficients
+// converted from the fixed point ones so both follow the same control
+// curve. Each output is saturated before mixOutput() mixes them, as in
+// the fixed point kernels.
+#define SVF_COEF_SCALE (1.0f / 1073741824.0f) // MULT() is a * b >> 30
+
+#define SVF_SAMPLE_F32() do { \
+		input = *in++; \
+		lowpasstmp = bandpasstmp = highpasstmp = 0.0f; \
+		for (int step = 1; step <= OVERSAMPLE; step++) { \
+			lowpass += fmult * bandpass; \
+			highpass = inputprev + (input - inputprev) * (step * (1.0f / OVERSAMPLE)) - \
+				lowpass - damp * bandpass; \
+			bandpass += fmult * highpass; \
+			lowpasstmp += lowpass; \
+			bandpasstmp += bandpass; \
+			highpasstmp += highpass; \
+		} \
+		inputprev = input; \
+		if (MIXED) { \
+			*lp++ = float_to_int16( \
+				mixlp * float_saturate16(lowpasstmp * (1.0f / OVERSAMPLE)) + \
+				mixbp * float_saturate16(bandpasstmp * (1.0f / OVERSAMPLE)) + \
+				mixhp * float_saturate16(highpasstmp * (1.0f / OVERSAMPLE))); \
+		} else { \
+			*lp++ = float_to_int16(lowpasstmp * (1.0f / OVERSAMPLE)); \
+			*bp++ = float_to_int16(bandpasstmp * (1.0f / OVERSAMPLE)); \
+			*hp++ = float_to_int16(highpasstmp * (1.0f / OVERSAMPLE)); \
+		} \
+	} while (0)
+
+// The 16.16 mix gains
+#define SVF_MIX_GAINS_F32() \
+	const float mixlp = setting_mixlp * (1.0f / 65536.0f); \
+	const float mixbp = setting_mixbp * (1.0f / 65536.0f); \
+	const float mixhp = setting_mixhp * (1.0f / 65536.0f)
 
-void AudioFilterStateVariableTS::update(void)
+template <bool MIXED, int OVERSAMPLE>
+FASTRUN void AudioFilterStateVariableTS::update_fixed_f32(const int16_t *in, int32_t coef,
+	int16_t *lp, int16_t *bp, int16_t *hp)
+{
+	const int16_t *end = in + AUDIO_BLOCK_SAMPLES;
+	const float fmult = oversampled_fmult<OVERSAMPLE>(coef) * SVF_COEF_SCALE;
+	const float damp = setting_damp * SVF_COEF_SCALE;
+	float input, inputprev;
+	float lowpass, bandpass, highpass;
+	float lowpasstmp, bandpasstmp, highpasstmp;
+
+	SVF_MIX_GAINS_F32();
+
+	inputprev = fstate_inputprev;
+	lowpass = fstate_lowpass;
+	bandpass = fstate_bandpass;
+	do {
+		SVF_SAMPLE_F32();
+	} while (in < end);
+	fstate_inputprev = inputprev;
+	fstate_lowpass = lowpass;
+	fstate_bandpass = bandpass;
+	state_fmult = coef;
+}
+
+template <bool MIXED, int OVERSAMPLE>
+FASTRUN void AudioFilterStateVariableTS::update_variable_f32(const int16_t *in,
+	const int16_t *ctl, int16_t *lp, int16_t *bp, int16_t *hp)
+{
+	const int16_t *end = in + AUDIO_BLOCK_SAMPLES;
+	const float damp = setting_damp * SVF_COEF_SCALE;
+	float input, inputprev;
+	float lowpass, bandpass, highpass;
+	float lowpasstmp, bandpasstmp, highpasstmp;
+	float fmult;
+	int32_t coef;
+
+	SVF_MIX_GAINS_F32();
+
+	inputprev = fstate_inputprev;
+	lowpass = fstate_lowpass;
+	bandpass = fstate_bandpass;
+	do {
+		coef = control_fmult(*ctl++);
+		fmult = oversampled_fmult<OVERSAMPLE>(coef) * SVF_COEF_SCALE;
+		SVF_SAMPLE_F32();
+	} while (in < end);
+	fstate_inputprev = inputprev;
+	fstate_lowpass = lowpass;
+	fstate_bandpass = bandpass;
+	state_fmult = coef;
+}
+
+template <bool MIXED, int OVERSAMPLE>
+FASTRUN void AudioFilterStateVariableTS::update_interpolated_f32(const int16_t *in,
+	const int16_t *ctl, int16_t *lp, int16_t *bp, int16_t *hp)
+{
+	const int16_t *end = in + AUDIO_BLOCK_SAMPLES;
+	const uint32_t step = 1 << setting_ctlshift;
+	const float ramp = 1.0f / step;
+	const float damp = setting_damp * SVF_COEF_SCALE;
+	float input, inputprev;
+	float lowpass, bandpass, highpass;
+	float lowpasstmp, bandpasstmp, highpasstmp;
+	float fmult, target, delta;
+	int32_t coef = state_fmult;
+
+	SVF_MIX_GAINS_F32();
+
+	inputprev = fstate_inputprev;
+	lowpass = fstate_lowpass;
+	bandpass = fstate_bandpass;
+	fmult = oversampled_fmult<OVERSAMPLE>(coef) * SVF_COEF_SCALE;
+	do {
+		ctl += step;
+		coef = control_fmult(ctl[-1]);
+		target = oversampled_fmult<OVERSAMPLE>(coef) * SVF_COEF_SCALE;
+		delta = (target - fmult) * ramp;
+		for (uint32_t i=0; i < step - 1; i++) {
+			fmult += delta;
+			SVF_SAMPLE_F32();
+		}
+		fmult = target;
+		SVF_SAMPLE_F32();
+	} while (in < end);
+	fstate_inputprev = inputprev;
+	fstate_lowpass = lowpass;
+	fstate_bandpass = bandpass;
+	state_fmult = coef;
+}
+
+static inline bool control_is_constant(const int16_t *ctl)
+{
+	const uint32_t *p = (const uint32_t *)ctl;
+	const uint32_t *end = p + AUDIO_BLOCK_SAMPLES/2;
+	const uint32_t first = (*p & 0xFFFF) | (*p << 16);
+	do {
+		if (*p++ != first) return false;
+	} while (p < end);
+	return true;
+}
+
+// Pick the cheapest path for this block's control signal, ctl is NULL when
+// nothing is connected to the control input and constant when the block
+// came tagged as one value
+template <bool MIXED, int OVERSAMPLE>
+FASTRUN void AudioFilterStateVariableTS::update_block(const int16_t *in,
+	const int16_t *ctl, bool constant, int16_t *lp, int16_t *bp, int16_t *hp)
+{
+	int32_t fmult = setting_fmult;
+	if (ctl && (constant || control_is_constant(ctl))) {
+		// Sustained envelope, no LFO: reuse the last coefficient
+		// unless the control level moved
+		if (!cached_valid || cached_control != ctl[0]) {
+			cached_control = ctl[0];
+			cached_fmult = control_fmult(cached_control);
+			cached_valid = true;
+		}
+		fmult = cached_fmult;
+		ctl = NULL;
+	}
+	if (setting_float) {
+		if (!ctl) update_fixed_f32<MIXED, OVERSAMPLE>(in, fmult, lp, bp, hp);
+		else if (setting_ctlshift) update_interpolated_f32<MIXED, OVERSAMPLE>(in, ctl, lp, bp, hp);
+		else update_variable_f32<MIXED, OVERSAMPLE>(in, ctl, lp, bp, hp);
+	} else {
+		if (!ctl) update_fixed<MIXED, OVERSAMPLE>(in, fmult, lp, bp, hp);
+		else if (setting_ctlshift) update_interpolated<MIXED, OVERSAMPLE>(in, ctl, lp, bp, hp);
+		else update_variable<MIXED, OVERSAMPLE>(in, ctl, lp, bp, hp);
+	}
+}
+
+template <bool MIXED>
+FASTRUN void AudioFilterStateVariableTS::update_oversampled(const int16_t *in,
+	const int16_t *ctl, bool constant, int16_t *lp, int16_t *bp, int16_t *hp)
+{
+	switch (setting_oversample) {
+	case 1: update_block<MIXED, 1>(in, ctl, constant, lp, bp, hp); break;
+	case 4: update_block<MIXED, 4>(in, ctl, constant, lp, bp, hp); break;
+	default: update_block<MIXED, 2>(in, ctl, constant, lp, bp, hp); break;
+	}
+}
+
+FASTRUN void AudioFilterStateVariableTS::update(void)
 {
 	audio_block_t *input_block=NULL, *control_block=NULL;
-	audio_block_t *lowpass_block=NULL, *bandpass_block=NULL, *highpass_block=NULL;
+	audio_block_t *lowpass_block, *bandpass_block=NULL, *highpass_block=NULL;
+	const int16_t *ctl;
+	bool constant;
 
-	input_block = receiveReadOnly(0);
+	// The lowpass (or mixed) output is written over the input, the
+	// kernels read each sample before they replace it
+	input_block = receiveWritable(0);
 	control_block = receiveReadOnly(1);
 	if (!input_block) {
-		if (control_block) release(control_block);
+		if (control_block) AudioBlockTags::release(control_block);
 		return;
 	}
-	lowpass_block = allocate();
-	if (!lowpass_block) {
-		release(input_block);
-		if (control_block) release(control_block);
+	AudioBlockTags::tag(input_block, AUDIO_BLOCK_TAG_NONE);
+	lowpass_block = input_block;
+	ctl = control_block ? control_block->data : NULL;
+	constant = control_block && AudioBlockTags::isConstant(control_block);
+	if (constant) AudioBlockTags::skipped += AUDIO_BLOCK_SAMPLES;
+
+	if (setting_mixed) {
+		update_oversampled<true>(input_block->data, ctl, constant, lowpass_block->data, NULL, NULL);
+		if (control_block) AudioBlockTags::release(control_block);
+		transmit(lowpass_block, 0);
+		release(lowpass_block);
 		return;
 	}
+
 	bandpass_block = allocate();
 	if (!bandpass_block) {
-		release(input_block);
 		release(lowpass_block);
-		if (control_block) release(control_block);
+		if (control_block) AudioBlockTags::release(control_block);
 		return;
 	}
 	highpass_block = allocate();
 	if (!highpass_block) {
-		release(input_block);
 		release(lowpass_block);
 		release(bandpass_block);
-		if (control_block) release(control_block);
+		if (control_block) AudioBlockTags::release(control_block);
 		return;
 	}
 
-	if (control_block) {
-		update_variable(input_block->data,
-			 control_block->data,
-			 lowpass_block->data,
-			 bandpass_block->data,
-			 highpass_block->data);
-		release(control_block);
-	} else {
-		update_fixed(input_block->data,
-			 lowpass_block->data,
-			 bandpass_block->data,
-			 highpass_block->data);
-	}
-	release(input_block);
+	update_oversampled<false>(input_block->data,
+		 ctl,
+		 constant,
+		 lowpass_block->data,
+		 bandpass_block->data,
+		 highpass_block->data);
+	if (control_block) AudioBlockTags::release(control_block);
 	transmit(lowpass_block, 0);
 	release(lowpass_block);
 	transmit(bandpass_block, 1);
@@ -227,7 +487,7 @@ void AudioFilterStateVariableTS::update(void)
 
 #elif defined(KINETISL)
 
-void AudioFilterStateVariableTS::update(void)
+FASTRUN void AudioFilterStateVariableTS::update(void)
 {
 	audio_block_t *block;
 
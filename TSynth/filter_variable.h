@@ -32,6 +32,7 @@
 
 #include "Arduino.h"
 #include "AudioStream.h"
+#include "float_kernels.h"
 
 class AudioFilterStateVariableTS: public AudioStream
 {
@@ -43,6 +44,14 @@ public:
 		state_inputprev = 0;
 		state_lowpass = 0;
 		state_bandpass = 0;
+		state_fmult = setting_fmult;
+		setting_ctlshift = 0;
+		setting_mixed = false;
+		fstate_inputprev = 0;
+		fstate_lowpass = 0;
+		fstate_bandpass = 0;
+		setting_float = FLOAT_SVF;
+		setting_oversample = 2;
 	}
 	void frequency(float freq) {
 		if (freq < 1.0) freq = 1.0;//ElectroTechnique changed from 20.0 to make dc offset filter
@@ -53,6 +62,7 @@ public:
 		// so the sinf() function isn't linked?
 		setting_fmult = sinf(freq * (3.141592654/(AUDIO_SAMPLE_RATE_EXACT*2.0)))
 			* 2147483647.0;
+		cached_valid = false;
 	}
 	void resonance(float q) {
 		if (q < 0.7) q = 0.7;
@@ -67,13 +77,86 @@ public:
 		if (n < 0.0) n = 0.0;
 		else if (n > 6.9999) n = 6.9999;
 		setting_octavemult = n * 4096.0;
+		cached_valid = false;
+	}
+	// How often the control input is converted to a corner frequency:
+	// 1 = every sample, otherwise every N samples (power of two, up to 64)
+	// with the coefficient linearly interpolated in between
+	void controlRate(uint8_t samples) {
+		uint8_t shift = 0;
+		while (shift < 6 && (1 << (shift + 1)) <= samples
+			&& (1 << (shift + 1)) <= AUDIO_BLOCK_SAMPLES) shift++;
+		setting_ctlshift = shift;
+	}
+	uint8_t controlRate() const {
+		return 1 << setting_ctlshift;
+	}
+	// Write lowpass*lp + bandpass*bp + highpass*hp to output 0 only,
+	// instead of the three outputs. Two fewer blocks to allocate and
+	// no mixer pass afterwards.
+	void mixOutput(float lp, float bp, float hp) {
+		setting_mixlp = mix_gain(lp);
+		setting_mixbp = mix_gain(bp);
+		setting_mixhp = mix_gain(hp);
+		setting_mixed = true;
+	}
+	// Back to lowpass, bandpass and highpass on outputs 0, 1 and 2
+	void separateOutputs() {
+		setting_mixed = false;
+	}
+	// Steps per sample: 1, 2 (the default) or 4. Fewer halve the cost and
+	// stop the corner at fs/6, more take the warping out of the top
+	// octave. Taken up at the next block.
+	void oversample(uint8_t factor) {
+		setting_oversample = factor >= 4 ? 4 : factor <= 1 ? 1 : 2;
+	}
+	uint8_t oversampling() {
+		return setting_oversample;
+	}
+	// The float32 kernels rather than fixed point, see float_kernels.h.
+	// The filter state carries over.
+	void useFloat(bool enable) {
+		__disable_irq();
+		if (enable && !setting_float) {
+			fstate_inputprev = state_inputprev * (1.0f / 4096.0f);
+			fstate_lowpass = state_lowpass * (1.0f / 4096.0f);
+			fstate_bandpass = state_bandpass * (1.0f / 4096.0f);
+		} else if (!enable && setting_float) {
+			state_inputprev = fstate_inputprev * 4096.0f;
+			state_lowpass = fstate_lowpass * 4096.0f;
+			state_bandpass = fstate_bandpass * 4096.0f;
+		}
+		setting_float = enable;
+		__enable_irq();
 	}
 	virtual void update(void);
 private:
-	void update_fixed(const int16_t *in,
+	// Same 16.16 gain format as AudioMixer4
+	static int32_t mix_gain(float gain) {
+		if (gain > 32767.0f) gain = 32767.0f;
+		else if (gain < -32767.0f) gain = -32767.0f;
+		return gain * 65536.0f;
+	}
+	// MIXED writes one mixed block to lp, bp and hp are unused. OVERSAMPLE
+	// is the steps per sample, see oversample().
+	template <bool MIXED, int OVERSAMPLE> void update_fixed(const int16_t *in, int32_t fmult,
+		int16_t *lp, int16_t *bp, int16_t *hp);
+	template <bool MIXED, int OVERSAMPLE> void update_variable(const int16_t *in, const int16_t *ctl,
+		int16_t *lp, int16_t *bp, int16_t *hp);
+	template <bool MIXED, int OVERSAMPLE> void update_interpolated(const int16_t *in, const int16_t *ctl,
+		int16_t *lp, int16_t *bp, int16_t *hp);
+	template <bool MIXED, int OVERSAMPLE> void update_block(const int16_t *in, const int16_t *ctl,
+		bool constant, int16_t *lp, int16_t *bp, int16_t *hp);
+	template <bool MIXED> void update_oversampled(const int16_t *in, const int16_t *ctl,
+		bool constant, int16_t *lp, int16_t *bp, int16_t *hp);
+	// The same in float, in sample units where the above work in 4096ths
+	template <bool MIXED, int OVERSAMPLE> void update_fixed_f32(const int16_t *in, int32_t fmult,
+		int16_t *lp, int16_t *bp, int16_t *hp);
+	template <bool MIXED, int OVERSAMPLE> void update_variable_f32(const int16_t *in, const int16_t *ctl,
 		int16_t *lp, int16_t *bp, int16_t *hp);
-	void update_variable(const int16_t *in, const int16_t *ctl,
+	template <bool MIXED, int OVERSAMPLE> void update_interpolated_f32(const int16_t *in, const int16_t *ctl,
 		int16_t *lp, int16_t *bp, int16_t *hp);
+	int32_t control_fmult(int32_t control);
 	int32_t setting_fcenter;
 	int32_t setting_fmult;
 	int32_t setting_octavemult;
@@ -81,6 +164,20 @@ private:
 	int32_t state_inputprev;
 	int32_t state_lowpass;
 	int32_t state_bandpass;
+	int32_t state_fmult;      // last coefficient used, start of the next ramp
+	int32_t cached_control;   // constant control value seen last block
+	int32_t cached_fmult;
+	bool cached_valid;
+	uint8_t setting_ctlshift;
+	bool setting_mixed;
+	int32_t setting_mixlp;
+	int32_t setting_mixbp;
+	int32_t setting_mixhp;
+	float fstate_inputprev;
+	float fstate_lowpass;
+	float fstate_bandpass;
+	bool setting_float;
+	uint8_t setting_oversample;
 	audio_block_t *inputQueueArray[2];
 };
 
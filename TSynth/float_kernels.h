@@ -0,0 +1,70 @@
+#ifndef TSYNTH_FLOAT_KERNELS_H
+#define TSYNTH_FLOAT_KERNELS_H
+
+#include <stdint.h>
+
+// Kernels with a float32 variant for the Teensy 4.1's FPU beside the fixed
+// point one they grew from. Each object starts on the variant chosen here,
+// -D FLOAT_SVF=1 and so on to override, and useFloat() switches one while
+// running so both can be compared in the same build: the float_kernels
+// test does on the host and KERNEL_BENCHMARK in TSynth.cpp on the Teensy.
+//
+// test_float_kernels, 128 sample blocks, host microseconds per block for 12
+// voices (one ensemble), the largest difference between the variants and
+// the error against a double precision model:
+//
+//   kernel          fixed us  float us  max diff  fixed dB  float dB
+//   state variable     37.0      31.2     4 LSB     -60.3     -60.4
+//   envelope           11.2      12.8     4 LSB     -78.9     -88.8
+//   mixer bus           3.2       1.8     4 LSB     -73.2     -83.1
+//   ensemble            5.1       5.9     1 LSB         -         -
+//
+// The host can't stand in for the Cortex-M7: the x86 timings above only
+// show which kernels are worth measuring. The defaults are decided by the
+// teensy41_bench build, processorUsageMax() of one object on each variant
+// with a held chord and a moving filter. Every kernel stays on fixed point
+// until its row here has Teensy numbers showing float ahead:
+//
+//   kernel          fixed %   float %   (teensy41_bench)
+//   state variable       -         -
+//   envelope             -         -
+//   mixer bus            -         -
+//   ensemble             -         -
+//
+// The filter is the likeliest to gain, six 32x32 multiplies with shifts
+// and three saturations a sample against multiply-adds in the FPU for the
+// same error. The envelope and the ensemble are slower in float on the
+// host and no better within 16 bits. The bus is better in float, but on
+// the M7 each input sample costs a conversion where the fixed point sum is
+// one multiply-accumulate.
+
+#ifndef FLOAT_SVF
+#define FLOAT_SVF 0
+#endif
+#ifndef FLOAT_ENVELOPE
+#define FLOAT_ENVELOPE 0
+#endif
+#ifndef FLOAT_MIXER_BUS
+#define FLOAT_MIXER_BUS 0
+#endif
+#ifndef FLOAT_ENSEMBLE
+#define FLOAT_ENSEMBLE 0
+#endif
+
+// A float in sample units clamped to what a sample holds, for
+// intermediates that the fixed point kernel saturates
+static inline float float_saturate16(float x)
+{
+	return x > 32767.0f ? 32767.0f : (x < -32768.0f ? -32768.0f : x);
+}
+
+// A float in sample units to a sample, saturated and truncated toward zero
+// as VCVT does
+static inline int16_t float_to_int16(float x)
+{
+	if (x > 32767.0f) return 32767;
+	if (x < -32768.0f) return -32768;
+	return (int16_t)x;
+}
+
+#endif
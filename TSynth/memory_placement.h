@@ -0,0 +1,31 @@
+#ifndef TSYNTH_MEMORY_PLACEMENT_H
+#define TSYNTH_MEMORY_PLACEMENT_H
+
+// Where code and data go on the Teensy 4.1, and why.
+//
+// ITCM  0x00000000  RAM1, code with no wait states. Code goes here unless
+//                   it's FLASHMEM, shared with DTCM in 32 KB banks.
+// DTCM  0x20000000  RAM1, data with no wait states: globals, statics and
+//                   the stack, and const data that isn't PROGMEM.
+// OCRAM 0x20200000  RAM2, DMAMEM and the heap, through the data cache.
+// Flash 0x60000000  FLASHMEM code and PROGMEM data, through the caches:
+//                   a miss costs tens of cycles.
+//
+// The audio update() functions and whatever they call per sample are
+// FASTRUN, ITCM on purpose rather than by default. Tables they read per
+// sample are FASTDATA, in DTCM. Setters, the UI and the patch code are
+// FLASHMEM and tables only read when a note or parameter changes stay
+// PROGMEM. Audio objects and their buffers, the ensemble's delay line in
+// particular, live in Global, which is a static so they're in DTCM: don't
+// allocate them. tools/map_report.cpp lists what went where from the
+// linker map.
+
+// A const table read by the audio kernels, e.g.
+// const int16_t FASTDATA WAVE[256] = {...};
+#if defined(__IMXRT1062__)
+#define FASTDATA __attribute__((section(".rodata.fastdata")))
+#else
+#define FASTDATA
+#endif
+
+#endif
@@ -0,0 +1,166 @@
+/* Audio Library for Teensy 3.X
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "mixer_bus.h"
+#include "block_tags.h"
+#include "utility/dspinst.h"
+
+#define MULTI_UNITYGAIN 65536
+
+// Adds a block to the sum at mult (16.16), the first one sets it
+template <bool FIRST>
+static FASTRUN void busAccumulate(int32_t *sum, const int16_t *data, int32_t mult)
+{
+	const uint32_t *src = (const uint32_t *)data;
+	const int32_t *end = sum + AUDIO_BLOCK_SAMPLES;
+
+	if (mult == MULTI_UNITYGAIN) {
+		do {
+			uint32_t tmp32 = *src++; // read 2 samples from *data
+			int32_t val1 = (int16_t)tmp32;
+			int32_t val2 = (int32_t)tmp32 >> 16;
+			sum[0] = FIRST ? val1 : sum[0] + val1;
+			sum[1] = FIRST ? val2 : sum[1] + val2;
+			sum += 2;
+		} while (sum < end);
+	} else {
+		do {
+			uint32_t tmp32 = *src++;
+			int32_t val1 = signed_multiply_32x16b(mult, tmp32);
+			int32_t val2 = signed_multiply_32x16t(mult, tmp32);
+			sum[0] = FIRST ? val1 : sum[0] + val1;
+			sum[1] = FIRST ? val2 : sum[1] + val2;
+			sum += 2;
+		} while (sum < end);
+	}
+}
+
+static inline int32_t busSaturate(int64_t val)
+{
+	return val > 32767 ? 32767 : (val < -32768 ? -32768 : (int32_t)val);
+}
+
+// The sum plus a constant at the bus gain, saturated to 16 bits
+static FASTRUN void busOutput(int16_t *data, const int32_t *sum, int32_t offset, int32_t mult)
+{
+	uint32_t *dst = (uint32_t *)data;
+	const uint32_t *end = (uint32_t *)(data + AUDIO_BLOCK_SAMPLES);
+
+	if (mult == MULTI_UNITYGAIN) {
+		do {
+			int32_t val1 = busSaturate((int64_t)sum[0] + offset);
+			int32_t val2 = busSaturate((int64_t)sum[1] + offset);
+			*dst++ = pack_16b_16b(val2, val1);
+			sum += 2;
+		} while (dst < end);
+	} else {
+		do {
+			int32_t val1 = busSaturate(((int64_t)(sum[0] + offset) * mult) >> 16);
+			int32_t val2 = busSaturate(((int64_t)(sum[1] + offset) * mult) >> 16);
+			*dst++ = pack_16b_16b(val2, val1);
+			sum += 2;
+		} while (dst < end);
+	}
+}
+
+// The same in float32, gains converted from 16.16
+template <bool FIRST>
+static FASTRUN void busAccumulate(float *sum, const int16_t *data, int32_t mult)
+{
+	const float gain = mult * (1.0f / MULTI_UNITYGAIN);
+	const float *end = sum + AUDIO_BLOCK_SAMPLES;
+
+	do {
+		const float val = *data++ * gain;
+		*sum = FIRST ? val : *sum + val;
+	} while (++sum < end);
+}
+
+static FASTRUN void busOutput(int16_t *data, const float *sum, float offset, int32_t mult)
+{
+	const float gain = mult * (1.0f / MULTI_UNITYGAIN);
+	const int16_t *end = data + AUDIO_BLOCK_SAMPLES;
+
+	do {
+		*data++ = float_to_int16((*sum++ + offset) * gain);
+	} while (data < end);
+}
+
+static inline void busAddConstant(int32_t &offset, int32_t mult, int16_t value)
+{
+	offset += signed_multiply_32x16b(mult, value);
+}
+
+static inline void busAddConstant(float &offset, int32_t mult, int16_t value)
+{
+	offset += value * (mult * (1.0f / MULTI_UNITYGAIN));
+}
+
+FASTRUN void AudioMixerBusBaseTS::update(void)
+{
+	if (floatSum) mix<float>();
+	else mix<int32_t>();
+}
+
+// T is what the sums are kept in
+template <class T>
+FASTRUN void AudioMixerBusBaseTS::mix()
+{
+	T sum[AUDIO_MIXER_BUS_MAX_CHANNELS][AUDIO_BLOCK_SAMPLES];
+	T offset[AUDIO_MIXER_BUS_MAX_CHANNELS] = {0};
+	bool summed[AUDIO_MIXER_BUS_MAX_CHANNELS] = {false};
+	bool constant[AUDIO_MIXER_BUS_MAX_CHANNELS] = {false};
+
+	unsigned int input = 0;
+	for (unsigned int source=0; source < sources; source++) {
+		const int32_t mult = multiplier[source];
+		for (unsigned int channel=0; channel < channels; channel++, input++) {
+			audio_block_t *in = receiveReadOnly(input);
+			if (!in) continue;
+			if (mult == 0) {
+				AudioBlockTags::skipped += AUDIO_BLOCK_SAMPLES;
+			} else if (AudioBlockTags::isConstant(in)) {
+				// one value, added in the last pass
+				busAddConstant(offset[channel], mult, in->data[0]);
+				constant[channel] = true;
+				AudioBlockTags::skipped += AUDIO_BLOCK_SAMPLES;
+			} else if (!summed[channel]) {
+				busAccumulate<true>(sum[channel], in->data, mult);
+				summed[channel] = true;
+			} else {
+				busAccumulate<false>(sum[channel], in->data, mult);
+			}
+			AudioBlockTags::release(in);
+		}
+	}
+	for (unsigned int channel=0; channel < channels; channel++) {
+		if (!summed[channel]) {
+			if (!constant[channel] || offset[channel] == 0) continue;
+			memset(sum[channel], 0, sizeof(sum[channel]));
+		}
+		audio_block_t *out = allocate();
+		if (!out) return;
+		busOutput(out->data, sum[channel], offset[channel], busMultiplier);
+		transmit(out, channel);
+		release(out);
+	}
+}
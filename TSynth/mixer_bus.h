@@ -0,0 +1,89 @@
+/* Audio Library for Teensy 3.X
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// A summing bus for any number of sources: each source is CHANNELS inputs
+// wide, source s channel c on input s * CHANNELS + c, and channel c of
+// every source is summed to output c. Sources are scaled by their own gain
+// and added up in 32 bits, then the bus gain is applied once and the sum
+// saturated once, where a tree of AudioMixer4s saturates and writes a
+// whole block at every stage.
+//
+// Every input is released before the outputs are allocated. Sources at
+// zero gain are skipped and constant tagged blocks are added as one value,
+// see block_tags.h. The outputs are never tagged.
+
+#ifndef mixer_bus_h_
+#define mixer_bus_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+#include "float_kernels.h"
+
+#define AUDIO_MIXER_BUS_MAX_CHANNELS 2
+
+class AudioMixerBusBaseTS : public AudioStream
+{
+public:
+	virtual void update(void);
+	void gain(unsigned int source, float gain) {
+		if (source >= sources) return;
+		multiplier[source] = toMultiplier(gain);
+	}
+	// Applied to the sum, once
+	void gain(float gain) {
+		busMultiplier = toMultiplier(gain);
+	}
+	// Sum in float32 rather than 32 bit integers, see float_kernels.h
+	void useFloat(bool enable) {
+		floatSum = enable;
+	}
+protected:
+	AudioMixerBusBaseTS(uint8_t sources_, uint8_t channels_, audio_block_t **queue, int32_t *multipliers)
+		: AudioStream(sources_ * channels_, queue), multiplier(multipliers), busMultiplier(65536),
+		  sources(sources_), channels(channels_), floatSum(FLOAT_MIXER_BUS) {
+		for (int i=0; i < sources; i++) multiplier[i] = 65536;
+	}
+private:
+	template <class T> void mix();
+	static int32_t toMultiplier(float gain) {
+		if (gain > 32767.0f) gain = 32767.0f;
+		else if (gain < -32767.0f) gain = -32767.0f;
+		return gain * 65536.0f;
+	}
+	int32_t *multiplier;
+	int32_t busMultiplier;
+	uint8_t sources;
+	uint8_t channels;
+	bool floatSum;
+};
+
+template <uint8_t SOURCES, uint8_t CHANNELS = 1>
+class AudioMixerBusTS : public AudioMixerBusBaseTS
+{
+	static_assert(CHANNELS >= 1 && CHANNELS <= AUDIO_MIXER_BUS_MAX_CHANNELS, "mono or stereo");
+public:
+	AudioMixerBusTS(void) : AudioMixerBusBaseTS(SOURCES, CHANNELS, inputQueueArray, multipliers) {}
+private:
+	audio_block_t *inputQueueArray[SOURCES * CHANNELS];
+	int32_t multipliers[SOURCES];
+};
+
+#endif
@@ -0,0 +1,202 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2014, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "mixer_ts.h"
+#include "block_tags.h"
+#include "utility/dspinst.h"
+
+#define MULTI_UNITYGAIN 65536
+
+static FASTRUN void applyGain(int16_t *data, int32_t mult)
+{
+	uint32_t *p = (uint32_t *)data;
+	const uint32_t *end = (uint32_t *)(data + AUDIO_BLOCK_SAMPLES);
+
+	do {
+		uint32_t tmp32 = *p; // read 2 samples from *data
+		int32_t val1 = signed_multiply_32x16b(mult, tmp32);
+		int32_t val2 = signed_multiply_32x16t(mult, tmp32);
+		val1 = signed_saturate_rshift(val1, 16, 0);
+		val2 = signed_saturate_rshift(val2, 16, 0);
+		*p++ = pack_16b_16b(val2, val1);
+	} while (p < end);
+}
+
+static FASTRUN void applyGainThenAdd(int16_t *data, const int16_t *in, int32_t mult)
+{
+	uint32_t *dst = (uint32_t *)data;
+	const uint32_t *src = (uint32_t *)in;
+	const uint32_t *end = (uint32_t *)(data + AUDIO_BLOCK_SAMPLES);
+
+	if (mult == MULTI_UNITYGAIN) {
+		do {
+			uint32_t tmp32 = *dst;
+			*dst++ = signed_add_16_and_16(tmp32, *src++);
+			tmp32 = *dst;
+			*dst++ = signed_add_16_and_16(tmp32, *src++);
+		} while (dst < end);
+	} else {
+		do {
+			uint32_t tmp32 = *src++; // read 2 samples from *data
+			int32_t val1 = signed_multiply_32x16b(mult, tmp32);
+			int32_t val2 = signed_multiply_32x16t(mult, tmp32);
+			val1 = signed_saturate_rshift(val1, 16, 0);
+			val2 = signed_saturate_rshift(val2, 16, 0);
+			tmp32 = pack_16b_16b(val2, val1);
+			uint32_t tmp32b = *dst;
+			*dst++ = signed_add_16_and_16(tmp32, tmp32b);
+		} while (dst < end);
+	}
+}
+
+// Add a constant, or a ramp from start to end (16.16) over the block
+static FASTRUN void addControl(int16_t *data, int32_t start, int32_t end)
+{
+	int16_t *p = data;
+	int16_t *stop = data + AUDIO_BLOCK_SAMPLES;
+
+	if (start == end) {
+		int32_t offset = start >> 16;
+		do {
+			*p = signed_saturate_rshift(*p + offset, 16, 0);
+			p++;
+		} while (p < stop);
+	} else {
+		int32_t step = (end - start) / AUDIO_BLOCK_SAMPLES;
+		int32_t acc = start;
+		do {
+			acc += step;
+			*p = signed_saturate_rshift(*p + (acc >> 16), 16, 0);
+			p++;
+		} while (p < stop);
+	}
+}
+
+// Fill a block with one value, as a constant tagged output
+static FASTRUN void fillConstant(int16_t *data, int32_t value)
+{
+	uint32_t *p = (uint32_t *)data;
+	const uint32_t *end = (uint32_t *)(data + AUDIO_BLOCK_SAMPLES);
+	const uint32_t packed = pack_16b_16b(value, value);
+
+	do {
+		*p++ = packed;
+		*p++ = packed;
+	} while (p < end);
+}
+
+FASTRUN void AudioMixer4TS::update(void)
+{
+	audio_block_t *in, *out=NULL;
+	unsigned int channel;
+	int64_t start = 0, end = 0;
+	bool controlled = false;
+
+	for (channel=0; channel < 4; channel++) {
+		const AudioControlSignal *signal = controls[channel];
+		int32_t mult = multiplier[channel];
+		if (signal) {
+			if (signal->start == signal->end) {
+				// exactly what applyGain() makes of a block of this value
+				int32_t val = signal->end >> 16;
+				if (mult != MULTI_UNITYGAIN) {
+					val = signed_saturate_rshift(signed_multiply_32x16b(mult, val), 16, 0);
+				}
+				start += (int64_t)val << 16;
+				end += (int64_t)val << 16;
+			} else {
+				start += ((int64_t)signal->start * mult) >> 16;
+				end += ((int64_t)signal->end * mult) >> 16;
+			}
+			controlled = true;
+			// drop anything still connected to a control channel
+			in = receiveReadOnly(channel);
+			if (in) AudioBlockTags::release(in);
+			continue;
+		}
+		in = receiveReadOnly(channel);
+		if (!in) continue;
+		if (mult == 0) {
+			// turned down, e.g. noise or the oscillator FX at zero level
+			AudioBlockTags::skipped += AUDIO_BLOCK_SAMPLES;
+			AudioBlockTags::release(in);
+		} else if (AudioBlockTags::isConstant(in)) {
+			// one value, added with the control signals
+			int32_t val = in->data[0];
+			if (mult != MULTI_UNITYGAIN) {
+				val = signed_saturate_rshift(signed_multiply_32x16b(mult, val), 16, 0);
+			}
+			start += (int64_t)val << 16;
+			end += (int64_t)val << 16;
+			controlled = true;
+			AudioBlockTags::skipped += AUDIO_BLOCK_SAMPLES;
+			AudioBlockTags::release(in);
+		} else if (!out) {
+			// receiveWritable(), from the block already taken
+			if (in->ref_count > 1) {
+				out = allocate();
+				if (out) memcpy(out->data, in->data, sizeof(out->data));
+				AudioBlockTags::release(in);
+				if (!out) continue;
+			} else {
+				out = in;
+			}
+			if (mult != MULTI_UNITYGAIN) applyGain(out->data, mult);
+		} else {
+			applyGainThenAdd(out->data, in->data, mult);
+			AudioBlockTags::release(in);
+		}
+	}
+	if (controlled) {
+		// beyond full scale the sum saturates anyway
+		const int64_t limit = (int64_t)32767 << 16;
+		if (start > limit) start = limit;
+		else if (start < -limit) start = -limit;
+		if (end > limit) end = limit;
+		else if (end < -limit) end = -limit;
+		if (!out) {
+			// controls and constants only, still silent until one of
+			// them moves
+			if (start == 0 && end == 0) return;
+			out = allocate();
+			if (!out) return;
+			if (start == end) {
+				fillConstant(out->data, start >> 16);
+				AudioBlockTags::tag(out, AUDIO_BLOCK_TAG_CONSTANT);
+				transmit(out);
+				AudioBlockTags::release(out);
+				return;
+			}
+			memset(out->data, 0, sizeof(out->data));
+		}
+		if (start != 0 || end != 0) addControl(out->data, start, end);
+	}
+	if (out) {
+		transmit(out);
+		AudioBlockTags::release(out);
+	}
+}
@@ -0,0 +1,71 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2014, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * AudioMixer4 with control rate inputs: any channel can take an
+ * AudioControlSignal instead of audio blocks. The control signals are
+ * scaled by the channel gain and added to the mixed audio as one ramp.
+ *
+ * Channels at zero gain are skipped and constant tagged blocks are added
+ * with the control signals; when nothing else is left the output is a
+ * constant tagged block, see block_tags.h.
+ */
+
+#ifndef mixer_ts_h_
+#define mixer_ts_h_
+
+#include "Arduino.h"
+#include "AudioStream.h"
+#include "control_signal.h"
+
+class AudioMixer4TS : public AudioStream
+{
+public:
+	AudioMixer4TS(void) : AudioStream(4, inputQueueArray) {
+		for (int i=0; i<4; i++) {
+			multiplier[i] = 65536;
+			controls[i] = NULL;
+		}
+	}
+	virtual void update(void);
+	void gain(unsigned int channel, float gain) {
+		if (channel >= 4) return;
+		if (gain > 32767.0f) gain = 32767.0f;
+		else if (gain < -32767.0f) gain = -32767.0f;
+		multiplier[channel] = gain * 65536.0f; // TODO: proper roundoff?
+	}
+	// Read this channel from a control rate signal rather than audio
+	// blocks, NULL returns it to audio
+	void control(unsigned int channel, const AudioControlSignal *signal) {
+		if (channel >= 4) return;
+		controls[channel] = signal;
+		if (signal) active = true;
+	}
+private:
+	int32_t multiplier[4];
+	const AudioControlSignal *controls[4];
+	audio_block_t *inputQueueArray[4];
+};
+
+#endif
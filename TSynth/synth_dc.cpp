@@ -28,12 +28,19 @@
 #include <Arduino.h>
 #include "synth_dc.h"
 
-void AudioSynthWaveformDcTS::update(void)
+// The fill and ramp loops write 16 and 8 samples a pass
+static_assert(AUDIO_BLOCK_SAMPLES % 16 == 0, "AUDIO_BLOCK_SAMPLES must be a multiple of 16");
+
+FASTRUN void AudioSynthWaveformDcTS::update(void)
 {
   audio_block_t *block;
   uint32_t *p, *end, val;
   int32_t count, t1, t2, t3, t4;
 
+  if (controlOnly) {
+    update_control();
+    return;
+  }
   block = allocate();
   if (!block) return;
   p = (uint32_t *)(block->data);
@@ -153,3 +160,46 @@ void AudioSynthWaveformDcTS::update(void)
   transmit(block);
   release(block);
 }
+
+// Same state changes as update(), keeping only the levels at the start and
+// end of the block
+FASTRUN void AudioSynthWaveformDcTS::update_control(void)
+{
+  int32_t count, t;
+  int n;
+
+  if (state == 0) {
+    mode=modePending;
+    t = (mode!=GLIDE_EXP) ? magnitude : expMagnitude<<2;
+    signal.start = signal.end = t;
+  } else if(mode!=GLIDE_EXP) {
+    signal.start = magnitude;
+    count = substract_int32_then_divide_int32(target, magnitude, increment);
+    if (count >= AUDIO_BLOCK_SAMPLES) {
+      magnitude += increment * AUDIO_BLOCK_SAMPLES;
+    } else {
+      magnitude = target;
+      state = 0;
+      mode=modePending;
+    }
+    signal.end = magnitude;
+  } else {
+    signal.start = expMagnitude<<2;
+    for (n = 0; n < AUDIO_BLOCK_SAMPLES && state; n += 4) {
+      ysum=ysum+(int64_t)kf*(expTargetB-expMagnitude);
+      t=ysum>>32;
+      ysum=ysum+(int64_t)kf*(expTargetB-t);
+      t=ysum>>32;
+      ysum=ysum+(int64_t)kf*(expTargetB-t);
+      t=ysum>>32;
+      ysum=ysum+(int64_t)kf*(expTargetB-t);
+      expMagnitude=ysum>>32;
+      if((target-expMagnitude)*stepDirection<0)
+      {
+        state=0;
+        expMagnitude=expTargetB=expTarget;
+      }
+    }
+    signal.end = expMagnitude<<2;
+  }
+}
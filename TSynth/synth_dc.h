@@ -33,6 +33,7 @@
 #include "Arduino.h"
 #include "AudioStream.h"
 #include "utility/dspinst.h"
+#include "control_signal.h"
 
 // compute (a - b) / c
 // handling 32 bit integer overflow at every step
@@ -101,6 +102,16 @@ public:
     target=expTarget=0;
     expTargetB=0;
     kf=0x7ff00000; // Arbitrary positive coefficient until set. 
+    controlOnly=false;
+    signal.start=signal.end=0;
+  }
+  // Publish the level as a control rate signal instead of transmitting an
+  // audio block every update. Keeps this object updating even though it
+  // has no connections.
+  const AudioControlSignal *controlSignal() {
+    controlOnly = true;
+    active = true;
+    return &signal;
   }
   // immediately jump to the new DC level
   FLASHMEM void amplitude(float n) {
@@ -187,6 +198,7 @@ public:
   
   virtual void update(void);
 private:
+  void update_control(void);
 
   uint8_t  state;     // 0=steady output, 1=transitioning
   int32_t  magnitude; // current output
@@ -201,6 +213,9 @@ private:
   int32_t  expTarget;   // Target value. This is scaled down by 4 from the linear case.
   int32_t  expTargetB;  // Biased target value. This is set just beyond the target so the target can be hit earlier.
   int32_t  kf; // FIlter coefficient.
+
+  bool controlOnly;
+  AudioControlSignal signal;
 };
 
 #endif
@@ -28,6 +28,8 @@
 
 #include <Arduino.h>
 #include "synth_waveform.h"
+#include "block_tags.h"
+#include "Detune.h"
 #include "arm_math.h"
 #include "utility/dspinst.h"
 
@@ -35,10 +37,14 @@
 // uncomment for more accurate but more computationally expensive frequency modulation
 //#define IMPROVE_EXPONENTIAL_ACCURACY
 #define BASE_AMPLITUDE 0x6000  // 0x7fff won't work due to Gibb's phenomenon, so use 3/4 of full range.
+// FM fast path: exp2 evaluated every FM_SEGMENT_SAMPLES for smooth modulation
+#define FM_SEGMENT_SAMPLES 8
+static_assert(AUDIO_BLOCK_SAMPLES % FM_SEGMENT_SAMPLES == 0, "FM segments must fill the block");
+#define FM_SMOOTH_CURVATURE 1
 
 
 
-void AudioSynthWaveformTS::update(void)
+FASTRUN void AudioSynthWaveformTS::update(void)
 {
   audio_block_t *block;
   int16_t *bp, *end;
@@ -229,73 +235,243 @@ void AudioSynthWaveformTS::update(void)
 
 //--------------------------------------------------------------------------------
 
-void AudioSynthWaveformModulatedTS::update(void)
+// Phase increment for one FM input sample: inc * 2^(mod * factor), where the
+// product has 4 integer and 27 fractional bits of octaves
+static inline uint32_t fm_phase_step(int32_t mod, uint32_t factor, uint32_t inc)
 {
-  audio_block_t *block, *moddata, *shapedata;
-  int16_t *bp, *end;
-  int32_t val1, val2;
-  int16_t magnitude15;
-  uint32_t i, ph, index, index2, scale, priorphase;
-  const uint32_t inc = phase_increment;
+  int32_t n = mod * factor; // n is # of octaves to mod
+  int32_t ipart = n >> 27; // 4 integer bits
+  n &= 0x7FFFFFF;          // 27 fractional bits
+  #ifdef IMPROVE_EXPONENTIAL_ACCURACY
+  // exp2 polynomial suggested by Stefan Stenzel on "music-dsp"
+  // mail list, Wed, 3 Sep 2014 10:08:55 +0200
+  int32_t x = n << 3;
+  n = multiply_accumulate_32x32_rshift32_rounded(536870912, x, 1494202713);
+  int32_t sq = multiply_32x32_rshift32_rounded(x, x);
+  n = multiply_accumulate_32x32_rshift32_rounded(n, sq, 1934101615);
+  n = n + (multiply_32x32_rshift32_rounded(sq,
+    multiply_32x32_rshift32_rounded(x, 1358044250)) << 1);
+  n = n << 1;
+  #else
+  // exp2 algorithm by Laurent de Soras
+  // https://www.musicdsp.org/en/latest/Other/106-fast-exp2-approximation.html
+  n = (n + 134217728) << 3;
+
+  n = multiply_32x32_rshift32_rounded(n, n);
+  n = multiply_32x32_rshift32_rounded(n, 715827883) << 3;
+  n = n + 715827882;
+  #endif
+  uint32_t scale = n >> (14 - ipart);
+  uint64_t phstep = (uint64_t)inc * scale;
+  uint32_t phstep_msw = phstep >> 32;
+  if (phstep_msw < 0x7FFE) {
+    return phstep >> 16;
+  } else {
+    return 0x7FFE0000;
+  }
+}
 
-  moddata = receiveReadOnly(0);
-  shapedata = receiveReadOnly(1);
+// Most FM input on TSynth is a sum of DC levels, envelopes, glides and slow
+// LFOs, so whole blocks are either constant or nearly straight lines.
+// A block is treated as smooth while no second difference exceeds
+// FM_SMOOTH_CURVATURE, which admits quantised ramps and LFOs up to ~30Hz at
+// full depth; anything sharper (cross mod, square LFO edges) takes the
+// per-sample path.
+enum fm_block_kind { FM_CONSTANT, FM_SMOOTH, FM_AUDIO };
+
+static inline fm_block_kind fm_classify(const int16_t *bp)
+{
+  int32_t d1prev = bp[1] - bp[0];
+  bool constant = (d1prev == 0);
+  for (uint32_t i=2; i < AUDIO_BLOCK_SAMPLES; i++) {
+    const int32_t d1 = bp[i] - bp[i-1];
+    const int32_t d2 = d1 - d1prev;
+    if (d2 > FM_SMOOTH_CURVATURE || d2 < -FM_SMOOTH_CURVATURE) return FM_AUDIO;
+    if (d1 != 0) constant = false;
+    d1prev = d1;
+  }
+  return constant ? FM_CONSTANT : FM_SMOOTH;
+}
+
+// Supersaw
+
+FLASHMEM void ModulatedOscillatorTS::supersaw(uint8_t saws, float width)
+{
+  if (saws < 1) saws = 1;
+  else if (saws > SUPERSAW_MAX_SAWS) saws = SUPERSAW_MAX_SAWS;
+  if (width < 0.0f) width = 0.0f;
+  else if (width > 0.5f) width = 0.5f;
+  if (saws == supersaw_count && width == supersaw_width) return;
+  for (uint8_t k=0; k < saws; k++) {
+    // evenly along the 24 entry spread the unison voices use for one
+    // note, centred on the oscillator frequency
+    const float position = saws > 1 ? DETUNE[0][k * 23 / (saws - 1)] - 0.5f : 0.0f;
+    supersaw_ratio[k] = (1.0f + width * position) * 1073741824.0f;
+  }
+  // Summed saws with unrelated phases grow like sqrt(saws), but drift
+  // into phase now and then; 3/8 of full scale per saw leaves room for
+  // that and for the wider stereo side (12 bit gain)
+  supersaw_gain = 0.375f * 2.0f * 4096.0f / sqrtf(saws);
+  supersaw_count = saws;
+  supersaw_width = width;
+  supersawSpread(supersaw_spread);
+}
+
+FLASHMEM void ModulatedOscillatorTS::supersawSpread(float spread)
+{
+  if (spread < 0.0f) spread = 0.0f;
+  else if (spread > 1.0f) spread = 1.0f;
+  supersaw_spread = spread;
+  const uint8_t saws = supersaw_count;
+  for (uint8_t k=0; k < saws; k++) {
+    // outer saws widest, alternating sides so each side gets both ends
+    // of the detune range
+    float pan = saws > 1 ? fabsf(2.0f * k - (saws - 1)) / (saws - 1) : 0.0f;
+    if (k & 1) pan = -pan;
+    supersaw_left[k] = 256.0f * (1.0f + spread * pan);
+  }
+}
+
+// Spread the starting phases so the saws don't start out as one
+void ModulatedOscillatorTS::supersaw_reset(void)
+{
+  for (uint32_t k=0; k < SUPERSAW_MAX_SAWS; k++) {
+    supersaw_phase[k] = k * 0x9E3779B9u;
+  }
+}
+
+// One polyBLEP corrected saw step, 14 fractional bits (+/-16384). The
+// residual is 2x - x^2 - 1 for the sample just after the wrap and
+// x^2 + 2x + 1 for the one just before it, x being the distance from the
+// wrap in phase increments.
+static inline int32_t supersaw_sample(uint32_t ph, uint32_t inc)
+{
+  int32_t s = (int32_t)(ph ^ 0x80000000u) >> 17;
+  if (ph < inc) {
+    const int32_t x = ((uint64_t)ph << 14) / inc;
+    s -= 2 * x - ((x * x) >> 14) - 16384;
+  } else if (0u - ph < inc) {
+    const int32_t x = -(int32_t)(((uint64_t)(0u - ph) << 14) / inc);
+    s -= ((x * x) >> 14) + 2 * x + 16384;
+  }
+  return s;
+}
+
+// Every saw advances by its ratio of this oscillator's phase step, so
+// frequency modulation computed once for the block drives all of them.
+// right is NULL for mono output.
+FASTRUN void ModulatedOscillatorTS::update_supersaw(int16_t *left,
+  int16_t *right, uint32_t prior)
+{
+  const uint32_t saws = supersaw_count;
+  const int32_t gain = multiply_32x32_rshift32(supersaw_gain << 16, magnitude);
+  uint32_t phase[SUPERSAW_MAX_SAWS];
+  uint32_t i, k;
+
+  for (k=0; k < saws; k++) phase[k] = supersaw_phase[k];
+  for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+    const uint32_t step = phasedata[i] - prior;
+    int32_t sum = 0, sumleft = 0;
+    prior = phasedata[i];
+    for (k=0; k < saws; k++) {
+      const uint32_t inc = ((uint64_t)step * supersaw_ratio[k]) >> 30;
+      const int32_t s = supersaw_sample(phase[k] += inc, inc);
+      sum += s;
+      if (right) sumleft += s * supersaw_left[k];
+    }
+    if (right) {
+      // left and right weights sum to 2, so left + right is twice the
+      // mono sum
+      sumleft >>= 8;
+      *left++ = signed_saturate_rshift(sumleft * gain, 16, 12);
+      *right++ = signed_saturate_rshift((2 * sum - sumleft) * gain, 16, 12);
+    } else {
+      *left++ = signed_saturate_rshift(sum * gain, 16, 12);
+    }
+  }
+  for (k=0; k < saws; k++) supersaw_phase[k] = phase[k];
+}
 
+uint32_t ModulatedOscillatorTS::phases(const int16_t *mod, bool constant)
+{
+  const int16_t *bp;
+  uint32_t i, ph, priorphase;
+  const uint32_t inc = phase_increment;
+
+  // Pre-compute the phase angle for every output sample of this update
+  priorphase = phasedata[AUDIO_BLOCK_SAMPLES-1];
   if(syncFlag==1){
     phase_accumulator = 0;
     syncFlag = 0;
+    // restart the supersaw from its spread phases, stepping in from
+    // where the reset phase would have been
+    priorphase = 0u - inc;
+    supersaw_reset();
   }        
   
-  // Pre-compute the phase angle for every output sample of this update
   ph = phase_accumulator;
-  priorphase = phasedata[AUDIO_BLOCK_SAMPLES-1];
-  if (moddata && modulation_type == 0) {
+  if (mod && modulation_type == 0) {
     // Frequency Modulation
-    bp = moddata->data;
-    for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
-      int32_t n = (*bp++) * modulation_factor; // n is # of octaves to mod
-      int32_t ipart = n >> 27; // 4 integer bits
-      n &= 0x7FFFFFF;          // 27 fractional bits
-      #ifdef IMPROVE_EXPONENTIAL_ACCURACY
-      // exp2 polynomial suggested by Stefan Stenzel on "music-dsp"
-      // mail list, Wed, 3 Sep 2014 10:08:55 +0200
-      int32_t x = n << 3;
-      n = multiply_accumulate_32x32_rshift32_rounded(536870912, x, 1494202713);
-      int32_t sq = multiply_32x32_rshift32_rounded(x, x);
-      n = multiply_accumulate_32x32_rshift32_rounded(n, sq, 1934101615);
-      n = n + (multiply_32x32_rshift32_rounded(sq,
-        multiply_32x32_rshift32_rounded(x, 1358044250)) << 1);
-      n = n << 1;
-      #else
-      // exp2 algorithm by Laurent de Soras
-      // https://www.musicdsp.org/en/latest/Other/106-fast-exp2-approximation.html
-      n = (n + 134217728) << 3;
-
-      n = multiply_32x32_rshift32_rounded(n, n);
-      n = multiply_32x32_rshift32_rounded(n, 715827883) << 3;
-      n = n + 715827882;
-      #endif
-      uint32_t scale = n >> (14 - ipart);
-      uint64_t phstep = (uint64_t)inc * scale;
-      uint32_t phstep_msw = phstep >> 32;
-      if (phstep_msw < 0x7FFE) {
-        ph += phstep >> 16;
-      } else {
-        ph += 0x7FFE0000;
+    bp = mod;
+    fm_block_kind kind;
+    if (constant) {
+      kind = FM_CONSTANT;
+      AudioBlockTags::skipped += AUDIO_BLOCK_SAMPLES;
+    } else {
+      kind = fm_classify(bp);
+    }
+    switch (kind) {
+    case FM_CONSTANT: {
+      // DC offsets, sustained envelopes, held pitch bend: one exp2 per block
+      const uint32_t phstep = fm_phase_step(bp[0], modulation_factor, inc);
+      for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+        ph += phstep;
+        phasedata[i] = ph;
       }
-      phasedata[i] = ph;
+      break;
     }
-    release(moddata);
-  } else if (moddata) {
+    case FM_SMOOTH: {
+      // Glides and slow LFOs: exact exp2 at segment boundaries, phase
+      // increment linearly interpolated in between
+      uint32_t phstep = fm_phase_step(bp[0], modulation_factor, inc);
+      for (i=0; i < AUDIO_BLOCK_SAMPLES; i += FM_SEGMENT_SAMPLES) {
+        int32_t next;
+        if (i + FM_SEGMENT_SAMPLES < AUDIO_BLOCK_SAMPLES) {
+          next = bp[i + FM_SEGMENT_SAMPLES];
+        } else {
+          // extrapolate one sample past the end of the block
+          next = 2 * bp[AUDIO_BLOCK_SAMPLES-1] - bp[AUDIO_BLOCK_SAMPLES-2];
+          if (next > 32767) next = 32767;
+          else if (next < -32768) next = -32768;
+        }
+        const uint32_t nextstep = fm_phase_step(next, modulation_factor, inc);
+        const int32_t delta = (int32_t)(nextstep - phstep) / FM_SEGMENT_SAMPLES;
+        for (uint32_t j=i; j < i + FM_SEGMENT_SAMPLES; j++) {
+          ph += phstep;
+          phasedata[j] = ph;
+          phstep += delta;
+        }
+        phstep = nextstep;
+      }
+      break;
+    }
+    default:
+      // Audio rate modulation (cross mod, fast square LFOs): exp2 per sample
+      for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+        ph += fm_phase_step(*bp++, modulation_factor, inc);
+        phasedata[i] = ph;
+      }
+      break;
+    }
+  } else if (mod) {
     // Phase Modulation
-    bp = moddata->data;
+    bp = mod;
     for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
       // more than +/- 180 deg shift by 32 bit overflow of "n"
       uint32_t n = (uint16_t)(*bp++) * modulation_factor;
       phasedata[i] = ph + n;
       ph += inc;
     }
-    release(moddata);
   } else {
     // No Modulation Input
     for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
@@ -304,7 +480,11 @@ void AudioSynthWaveformModulatedTS::update(void)
     }
   }
   phase_accumulator = ph;
+  return priorphase;
+}
 
+bool ModulatedOscillatorTS::sounding(void)
+{
   //Amplitude is always 1 on TSynth when oscillator is sounding
   //magnitude must be set to zero, otherwise digital noise comes through
   if(tone_type == WAVEFORM_SILENT){
@@ -312,17 +492,18 @@ void AudioSynthWaveformModulatedTS::update(void)
   }else{
     magnitude = 65536.0;
     }                               
-  // If the amplitude is zero, no output, but phase still increments properly
-  if (magnitude == 0) {
-    if (shapedata) release(shapedata);
-    return;
-  }
-  block = allocate();
-  if (!block) {
-    if (shapedata) release(shapedata);
-    return;
-  }
-  bp = block->data;
+  return magnitude != 0;
+}
+
+bool ModulatedOscillatorTS::render(int16_t *bp, int16_t *right,
+  const int16_t *shape, uint32_t priorphase)
+{
+  int16_t *const out = bp;
+  int16_t *end;
+  int32_t val1, val2;
+  int16_t magnitude15;
+  uint32_t i, ph, index, index2, scale;
+  const uint32_t inc = phase_increment;
 
   // Now generate the output samples using the pre-computed phase angles
   switch(tone_type) {
@@ -340,11 +521,7 @@ void AudioSynthWaveformModulatedTS::update(void)
     break;
 
   case WAVEFORM_ARBITRARY:
-    if (!arbdata) {
-      release(block);
-      if (shapedata) release(shapedata);
-      return;
-    }
+    if (!arbdata) return false;
     // len = 256
     for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
       ph = phasedata[i];
@@ -361,10 +538,10 @@ void AudioSynthWaveformModulatedTS::update(void)
     break;
 
   case WAVEFORM_PULSE:
-    if (shapedata) {
+    if (shape) {
       magnitude15 = signed_saturate_rshift(magnitude, 16, 1);
       for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
-        uint32_t width = ((shapedata->data[i] + 0x8000) & 0xFFFF) << 16;
+        uint32_t width = ((shape[i] + 0x8000) & 0xFFFF) << 16;
         if (phasedata[i] < width) {
           *bp++ = magnitude15;
         } else {
@@ -372,8 +549,8 @@ void AudioSynthWaveformModulatedTS::update(void)
         }
       }
       break;
-    } // else fall through to orginary square without shape modulation
-
+    }
+    // else fall through - to orginary square without shape modulation
   case WAVEFORM_SQUARE:
     magnitude15 = signed_saturate_rshift(magnitude, 16, 1);
     for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
@@ -386,17 +563,17 @@ void AudioSynthWaveformModulatedTS::update(void)
     break;
 
   case WAVEFORM_BANDLIMIT_PULSE:
-    if (shapedata)
+    if (shape)
     {
       for (i=0; i < AUDIO_BLOCK_SAMPLES; i++)
       {
-        uint32_t width = ((shapedata->data[i] + 0x8000) & 0xFFFF) << 16;
+        uint32_t width = ((shape[i] + 0x8000) & 0xFFFF) << 16;
         int32_t val = band_limit_waveform.generate_pulse (phasedata[i], width, i) ;
         *bp++ = (int16_t) ((val * magnitude) >> 16) ;
       }
       break;
-    } // else fall through to orginary square without shape modulation
-
+    }
+    // else fall through - to orginary square without shape modulation
   case WAVEFORM_BANDLIMIT_SQUARE:
     for (i = 0 ; i < AUDIO_BLOCK_SAMPLES ; i++)
     {
@@ -428,9 +605,9 @@ void AudioSynthWaveformModulatedTS::update(void)
     break;
 
   case WAVEFORM_TRIANGLE_VARIABLE:
-    if (shapedata) {
+    if (shape) {
       for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
-        uint32_t width = (shapedata->data[i] + 0x8000) & 0xFFFF;
+        uint32_t width = (shape[i] + 0x8000) & 0xFFFF;
         uint32_t rise = 0xFFFFFFFF / width;
         uint32_t fall = 0xFFFFFFFF / (0xFFFF - width);
         uint32_t halfwidth = width << 15;
@@ -449,8 +626,8 @@ void AudioSynthWaveformModulatedTS::update(void)
         ph += inc;
       }
       break;
-    } // else fall through to orginary triangle without shape modulation
-
+    }
+    // else fall through - to orginary triangle without shape modulation
   case WAVEFORM_TRIANGLE:
     for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
       ph = phasedata[i];
@@ -462,6 +639,10 @@ void AudioSynthWaveformModulatedTS::update(void)
       }
     }
     break;
+  case WAVEFORM_SUPERSAW:
+    update_supersaw(bp, right, priorphase);
+    break;
+
   case WAVEFORM_SAMPLE_HOLD:
     for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
       ph = phasedata[i];
@@ -475,16 +656,370 @@ void AudioSynthWaveformModulatedTS::update(void)
   }
 
   if (tone_offset) {
-    bp = block->data;
+    bp = out;
     end = bp + AUDIO_BLOCK_SAMPLES;
     do {
       val1 = *bp;
       *bp++ = signed_saturate_rshift(val1 + tone_offset, 16, 0);
     } while (bp < end);
   }
-  if (shapedata) release(shapedata);
+  return true;
+}
+
+FASTRUN void AudioSynthWaveformModulatedTS::update(void)
+{
+  audio_block_t *block, *right = NULL, *moddata, *shapedata;
+  uint32_t priorphase;
+
+  moddata = receiveReadOnly(0);
+  shapedata = receiveReadOnly(1);
+  if (moddata) {
+    priorphase = phases(moddata->data, AudioBlockTags::isConstant(moddata));
+    AudioBlockTags::release(moddata);
+  } else {
+    priorphase = phases(NULL, false);
+  }
+
+  // If the amplitude is zero, no output, but phase still increments properly
+  if (!sounding()) {
+    if (shapedata) AudioBlockTags::release(shapedata);
+    return;
+  }
+  block = allocate();
+  if (!block) {
+    if (shapedata) AudioBlockTags::release(shapedata);
+    return;
+  }
+  if (stereo()) {
+    // mono on output 0 if there's no block for the right
+    right = allocate();
+  }
+  if (!render(block->data, right ? right->data : NULL,
+      shapedata ? shapedata->data : NULL, priorphase)) {
+    release(block);
+    if (right) release(right);
+    if (shapedata) AudioBlockTags::release(shapedata);
+    return;
+  }
+  if (shapedata) AudioBlockTags::release(shapedata);
   transmit(block, 0);
   release(block);
+  if (right) {
+    transmit(right, 1);
+    release(right);
+  }
+}
+
+
+//--------------------------------------------------------------------------------
+// Hard sync
+
+// Waveforms that can be hard synced, evaluated straight from the phase
+bool ModulatedOscillatorTS::syncable(void)
+{
+  switch (tone_type) {
+  case WAVEFORM_SINE:
+  case WAVEFORM_SAWTOOTH:
+  case WAVEFORM_SAWTOOTH_REVERSE:
+  case WAVEFORM_SQUARE:
+  case WAVEFORM_PULSE:
+  case WAVEFORM_TRIANGLE:
+  case WAVEFORM_TRIANGLE_VARIABLE:
+  case WAVEFORM_BANDLIMIT_SAWTOOTH:
+  case WAVEFORM_BANDLIMIT_SAWTOOTH_REVERSE:
+  case WAVEFORM_BANDLIMIT_SQUARE:
+  case WAVEFORM_BANDLIMIT_PULSE:
+    return true;
+  case WAVEFORM_ARBITRARY:
+    return arbdata != NULL;
+  default:
+    return false;
+  }
+}
+
+// Restart the cycle wherever the master's phase wraps, at the same
+// fraction of a sample. incs gets each sample's phase step and resets how
+// far past a reset the sample is (16 bit fraction), or -1.
+FASTRUN void ModulatedOscillatorTS::resync(const uint32_t *master, uint32_t masterprior,
+  uint32_t prior, uint32_t *incs, int32_t *resets)
+{
+  uint32_t ph = prior;
+  for (uint32_t i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+    const uint32_t inc = phasedata[i] - prior;
+    const uint32_t m = master[i];
+    prior = phasedata[i];
+    incs[i] = inc;
+    if (m < masterprior) {
+      int32_t d = ((uint64_t)m << 16) / (m - masterprior);
+      if (d > 0xFFFF) d = 0xFFFF;
+      resets[i] = d;
+      ph = ((uint64_t)inc * d) >> 16;
+    } else {
+      resets[i] = -1;
+      ph += inc;
+    }
+    masterprior = m;
+    phasedata[i] = ph;
+  }
+  phase_accumulator += ph - prior;
+}
+
+// Synced waveform at phase ph, +/-32767 full scale, band limited ones at
+// the level BandLimitedWaveformTS gives them
+static FASTRUN int32_t sync_value(uint8_t type, uint32_t ph, uint32_t width, const int16_t *arb)
+{
+  uint32_t index, index2, scale, w, n;
+  int32_t val1, val2;
+
+  switch (type) {
+  case WAVEFORM_SINE:
+  case WAVEFORM_ARBITRARY:
+    index = ph >> 24;
+    index2 = index + 1;
+    if (type == WAVEFORM_SINE) {
+      val1 = AudioWaveformSine[index];
+      val2 = AudioWaveformSine[index2];
+    } else {
+      if (index2 >= 256) index2 = 0;
+      val1 = arb[index];
+      val2 = arb[index2];
+    }
+    scale = (ph >> 8) & 0xFFFF;
+    return (val1 * (int32_t)(0x10000 - scale) + val2 * (int32_t)scale) >> 16;
+  case WAVEFORM_SAWTOOTH:
+    return (int32_t)ph >> 16;
+  case WAVEFORM_SAWTOOTH_REVERSE:
+    return -((int32_t)ph >> 16);
+  case WAVEFORM_BANDLIMIT_SAWTOOTH:
+    return ((int32_t)ph >> 16) * BASE_AMPLITUDE >> 15;
+  case WAVEFORM_BANDLIMIT_SAWTOOTH_REVERSE:
+    return -(((int32_t)ph >> 16) * BASE_AMPLITUDE >> 15);
+  case WAVEFORM_SQUARE:
+    return ph & 0x80000000 ? -32767 : 32767;
+  case WAVEFORM_BANDLIMIT_SQUARE:
+    return ph & 0x80000000 ? -BASE_AMPLITUDE : BASE_AMPLITUDE;
+  case WAVEFORM_PULSE:
+    return ph < width ? 32767 : -32767;
+  case WAVEFORM_BANDLIMIT_PULSE:
+    return ph < width ? BASE_AMPLITUDE/2 : -BASE_AMPLITUDE/2;
+  case WAVEFORM_TRIANGLE:
+    if ((ph >> 30) == 1 || (ph >> 30) == 2) return 0xFFFF - (int32_t)(ph >> 15);
+    return (int32_t)ph >> 15;
+  case WAVEFORM_TRIANGLE_VARIABLE:
+    w = width >> 16;
+    if (w < 1) w = 1;
+    else if (w > 0xFFFE) w = 0xFFFE;
+    if (ph < (w << 15)) {
+      n = (ph >> 16) * (0xFFFFFFFF / w);
+    } else if (ph < 0xFFFFFFFF - (w << 15)) {
+      n = 0x7FFFFFFF - (((ph - (w << 15)) >> 16) * (0xFFFFFFFF / (0xFFFF - w)));
+    } else {
+      n = ((ph + (w << 15)) >> 16) * (0xFFFFFFFF / w) + 0x80000000;
+    }
+    return (int32_t)n >> 16;
+  default:
+    return 0;
+  }
+}
+
+// Phases where the synced waveform steps, and by how much
+static FASTRUN uint32_t sync_edges(uint8_t type, uint32_t width, uint32_t *at, int32_t *jump)
+{
+  switch (type) {
+  case WAVEFORM_SAWTOOTH:
+  case WAVEFORM_SAWTOOTH_REVERSE:
+  case WAVEFORM_BANDLIMIT_SAWTOOTH:
+  case WAVEFORM_BANDLIMIT_SAWTOOTH_REVERSE:
+    at[0] = 0x80000000u;
+    jump[0] = sync_value(type, 0x80000000u, 0, NULL) - sync_value(type, 0x7FFFFFFFu, 0, NULL);
+    return 1;
+  case WAVEFORM_SQUARE:
+  case WAVEFORM_BANDLIMIT_SQUARE:
+    width = 0x80000000u;
+    // fall through
+  case WAVEFORM_PULSE:
+  case WAVEFORM_BANDLIMIT_PULSE:
+    if (width == 0) return 0;
+    at[0] = 0;
+    jump[0] = 2 * sync_value(type, 0, width, NULL);
+    at[1] = width;
+    jump[1] = -jump[0];
+    return 2;
+  default:
+    return 0;
+  }
+}
+
+// Two sample polyBLEP for a step of size jump t (16 bit fraction) samples
+// before p[1]: the residual is (1-t)^2/2 of the step after it and t^2/2
+// before it
+static inline void sync_blep(int32_t *p, int32_t jump, uint32_t t)
+{
+  const int64_t after = 65536 - t;
+  p[1] -= (jump * after * after) >> 33;
+  p[0] += (jump * (int64_t)t * t) >> 33;
+}
+
+// A step at phase e, if the phase passed it on the way from 'from' to
+// 'to' at inc per sample; extra is the time from 'to' to the sample
+static inline void sync_edge(int32_t *p, uint32_t from, uint32_t to,
+  uint32_t inc, uint32_t e, int32_t jump, uint32_t extra)
+{
+  if (e - from - 1 >= to - from) return;
+  uint32_t t = (((uint64_t)(to - e) << 16) / inc) + extra;
+  if (t > 0xFFFF) t = 0xFFFF;
+  sync_blep(p, jump, t);
+}
+
+// The synced waveform from the phases resync() left, with every step in
+// it corrected: its own edges and the resets. Corrections reach back one
+// sample, so the output is one sample late.
+FASTRUN void ModulatedOscillatorTS::render_synced(int16_t *bp, const int16_t *shape,
+  uint32_t prior, const uint32_t *incs, const int32_t *resets)
+{
+  // static rather than on the interrupt's stack, see
+  // AudioSynthWaveformDualTS::update()
+  static int32_t buf[AUDIO_BLOCK_SAMPLES + 1];
+  uint32_t at[2], width = 0x80000000u, i, k, edges;
+  int32_t jump[2];
+
+  buf[0] = sync_held;
+  for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+    const uint32_t ph = phasedata[i], inc = incs[i];
+    if (shape) width = ((shape[i] + 0x8000) & 0xFFFF) << 16;
+    edges = sync_edges(tone_type, width, at, jump);
+    buf[i+1] = sync_value(tone_type, ph, width, arbdata);
+    if (resets[i] < 0) {
+      for (k=0; k < edges; k++) {
+        sync_edge(&buf[i], prior, ph, inc, at[k], jump[k], 0);
+      }
+    } else {
+      const uint32_t d = resets[i];
+      const uint32_t reset = prior + (uint32_t)(((uint64_t)inc * (65536 - d)) >> 16);
+      for (k=0; k < edges; k++) {
+        sync_edge(&buf[i], prior, reset, inc, at[k], jump[k], d);
+      }
+      sync_blep(&buf[i], sync_value(tone_type, 0, width, arbdata)
+        - sync_value(tone_type, reset, width, arbdata), d);
+      for (k=0; k < edges; k++) {
+        sync_edge(&buf[i], 0, ph, inc, at[k], jump[k], 0);
+      }
+    }
+    prior = ph;
+  }
+  sync_held = buf[AUDIO_BLOCK_SAMPLES];
+  for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+    bp[i] = signed_saturate_rshift(buf[i] + tone_offset, 16, 0);
+  }
+}
+
+//--------------------------------------------------------------------------------
+// AudioSynthWaveformDualTS
+
+// One mixer channel: src at mult (16.16) into dst, or added to it
+static FASTRUN void dual_mix(int16_t *dst, const int16_t *src, int32_t mult, bool add)
+{
+  for (uint32_t i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+    int32_t val = signed_saturate_rshift(((int64_t)mult * src[i]) >> 16, 16, 0);
+    if (add) val = signed_saturate_rshift(val + dst[i], 16, 0);
+    dst[i] = val;
+  }
+}
+
+static FASTRUN void dual_combine(int16_t *dst, const int16_t *a, const int16_t *b, uint8_t mode)
+{
+  uint32_t i;
+  switch (mode) {
+  case AudioEffectDigitalCombine::OR:
+    for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) dst[i] = a[i] | b[i];
+    break;
+  case AudioEffectDigitalCombine::XOR:
+    for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) dst[i] = a[i] ^ b[i];
+    break;
+  case AudioEffectDigitalCombine::AND:
+    for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) dst[i] = a[i] & b[i];
+    break;
+  case AudioEffectDigitalCombine::MODULO:
+    // per sample on the 16 bit patterns
+    for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+      dst[i] = b[i] ? (uint16_t)a[i] % (uint16_t)b[i] : a[i];
+    }
+    break;
+  }
+}
+
+FASTRUN void AudioSynthWaveformDualTS::update(void)
+{
+  audio_block_t *fm[2], *shape[2], *block;
+  ModulatedOscillatorTS *osc[2] = {&a, &b};
+  // Scratch for both oscillators, about 2 KB that would otherwise be on the
+  // stack inside the audio interrupt. Updates run one at a time there, so
+  // every instance shares one copy, a static in DTCM.
+  static int16_t out[2][AUDIO_BLOCK_SAMPLES];
+  static int16_t work[AUDIO_BLOCK_SAMPLES];
+  static uint32_t incs[AUDIO_BLOCK_SAMPLES];
+  static int32_t resets[AUDIO_BLOCK_SAMPLES];
+  uint32_t prior[2], i, n;
+  bool sounding[2] = {false, false}, mixed = false;
+
+  fm[0] = receiveReadOnly(0);
+  shape[0] = receiveReadOnly(1);
+  fm[1] = receiveReadOnly(2);
+  shape[1] = receiveReadOnly(3);
+
+  // The modulator is rendered first; A when syncing or without cross
+  // modulation
+  const uint8_t second = (xmod_multiplier && !hard_sync) ? xmod_carrier : 1;
+  for (n=0; n < 2; n++) {
+    const uint8_t k = n ? second : second ^ 1;
+    ModulatedOscillatorTS &o = *osc[k];
+    const int16_t *mod = fm[k] ? fm[k]->data : NULL;
+    bool constant = fm[k] && AudioBlockTags::isConstant(fm[k]);
+    if (n && xmod_multiplier && k == xmod_carrier && sounding[k ^ 1]) {
+      // the modulator's output on top of the modulation input, as one
+      // more mixer channel
+      const int16_t *src = out[k ^ 1];
+      for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+        int32_t val = signed_saturate_rshift(((int64_t)xmod_multiplier * src[i]) >> 16, 16, 0);
+        if (mod) val = signed_saturate_rshift(val + mod[i], 16, 0);
+        work[i] = val;
+      }
+      mod = work;
+      constant = false;
+    }
+    prior[k] = o.phases(mod, constant);
+    const bool synced = hard_sync && k == 1 && o.syncable();
+    if (synced) o.resync(a.phasedata, prior[0], prior[1], incs, resets);
+    if (!o.sounding()) continue;
+    const int16_t *sh = shape[k] ? shape[k]->data : NULL;
+    if (synced) {
+      o.render_synced(out[k], sh, prior[k], incs, resets);
+      sounding[k] = true;
+    } else {
+      sounding[k] = o.render(out[k], NULL, sh, prior[k]);
+    }
+  }
+  for (n=0; n < 2; n++) {
+    if (fm[n]) AudioBlockTags::release(fm[n]);
+    if (shape[n]) AudioBlockTags::release(shape[n]);
+  }
+
+  if (!sounding[0] && !sounding[1]) return;
+  block = allocate();
+  if (!block) return;
+  for (n=0; n < 2; n++) {
+    if (!sounding[n] || !multiplier[n]) continue;
+    dual_mix(block->data, out[n], multiplier[n], mixed);
+    mixed = true;
+  }
+  if (combine_mode != AudioEffectDigitalCombine::OFF && multiplier[2]
+      && sounding[0] && sounding[1]) {
+    dual_combine(work, out[0], out[1], combine_mode);
+    dual_mix(block->data, work, multiplier[2], mixed);
+    mixed = true;
+  }
+  if (mixed) transmit(block);
+  release(block);
 }
 
 
@@ -514,7 +1049,7 @@ extern "C"
   extern const int16_t step_table [258] ;
 }
 
-int32_t BandLimitedWaveformTS::lookup (int offset)
+FASTRUN int32_t BandLimitedWaveformTS::lookup (int offset)
 {
   int off = offset >> GUARD_BITS ;
   int frac = offset & (GUARD-1) ;
@@ -535,7 +1070,7 @@ int32_t BandLimitedWaveformTS::lookup (int offset)
 
 // create a new step, apply its past waveform into the cyclic sample buffer
 // and add a step_state object into active list so it can be added for the future samples
-void BandLimitedWaveformTS::insert_step (int offset, bool rising, int i)
+FASTRUN void BandLimitedWaveformTS::insert_step (int offset, bool rising, int i)
 {
   while (offset <= (N/2-SCALE)<<GUARD_BITS)
   {
@@ -552,7 +1087,7 @@ void BandLimitedWaveformTS::insert_step (int offset, bool rising, int i)
 
 // generate value for current sample from one active step, checking for the
 // dc_offset adjustment at the end of the table.
-int32_t BandLimitedWaveformTS::process_step (int i)
+FASTRUN int32_t BandLimitedWaveformTS::process_step (int i)
 {
   int off = states[i].offset ;
   bool positive = states[i].positive ;
@@ -569,7 +1104,7 @@ int32_t BandLimitedWaveformTS::process_step (int i)
 // process all active steps for current sample, basically generating the waveform portion
 // due only to steps
 // square waves use this directly.
-int32_t BandLimitedWaveformTS::process_active_steps (uint32_t new_phase)
+FASTRUN int32_t BandLimitedWaveformTS::process_active_steps (uint32_t /*new_phase*/)
 {
   int32_t sample = dc_offset ;
   
@@ -594,7 +1129,7 @@ int32_t BandLimitedWaveformTS::process_active_steps (uint32_t new_phase)
 }
 
 // for sawtooth need to add in the slope and compensate for all the steps being one way
-int32_t BandLimitedWaveformTS::process_active_steps_saw (uint32_t new_phase)
+FASTRUN int32_t BandLimitedWaveformTS::process_active_steps_saw (uint32_t new_phase)
 {
   int32_t sample = process_active_steps (new_phase) ;
 
@@ -607,7 +1142,7 @@ int32_t BandLimitedWaveformTS::process_active_steps_saw (uint32_t new_phase)
 }
 
 // for pulse need to adjust the baseline according to the pulse width to cancel the DC component.
-int32_t BandLimitedWaveformTS::process_active_steps_pulse (uint32_t new_phase, uint32_t pulse_width)
+FASTRUN int32_t BandLimitedWaveformTS::process_active_steps_pulse (uint32_t new_phase, uint32_t pulse_width)
 {
   int32_t sample = process_active_steps (new_phase) ;
 
@@ -615,7 +1150,7 @@ int32_t BandLimitedWaveformTS::process_active_steps_pulse (uint32_t new_phase, u
 }
 
 // Check for new steps using the phase update for the current sample for a square wave
-void BandLimitedWaveformTS::new_step_check_square (uint32_t new_phase, int i)
+FASTRUN void BandLimitedWaveformTS::new_step_check_square (uint32_t new_phase, int i)
 {
   if (new_phase >= DEG180 && phase_word < DEG180) // detect falling step
   {
@@ -645,7 +1180,7 @@ void BandLimitedWaveformTS::new_step_check_square (uint32_t new_phase, int i)
 // not letting a pulse glitch out of existence as these change across a single period of the waveform
 // now we detect the rising edge just like for a square wave and use that to sample the pulse width
 // parameter, which then has to be checked against the instantaneous frequency every sample.
-void BandLimitedWaveformTS::new_step_check_pulse (uint32_t new_phase, uint32_t pulse_width, int i)
+FASTRUN void BandLimitedWaveformTS::new_step_check_pulse (uint32_t new_phase, uint32_t pulse_width, int i)
 {
   if (pulse_state && phase_word < sampled_width && (new_phase >= sampled_width || new_phase < phase_word))  // falling edge
   {
@@ -679,7 +1214,7 @@ void BandLimitedWaveformTS::new_step_check_pulse (uint32_t new_phase, uint32_t p
 }
 
 // new steps for sawtooth are at 180 degree point, always falling.
-void BandLimitedWaveformTS::new_step_check_saw (uint32_t new_phase, int i)
+FASTRUN void BandLimitedWaveformTS::new_step_check_saw (uint32_t new_phase, int i)
 {
   if (new_phase >= DEG180 && phase_word < DEG180) // detect falling step
   {
@@ -693,7 +1228,7 @@ void BandLimitedWaveformTS::new_step_check_saw (uint32_t new_phase, int i)
 // the generation function pushd new sample into cyclic buffer, having taken out the oldest entry
 // to return.  The output is thus 16 samples behind, which allows the non-casual step function to
 // work in real time.
-int16_t BandLimitedWaveformTS::generate_sawtooth (uint32_t new_phase, int i)
+FASTRUN int16_t BandLimitedWaveformTS::generate_sawtooth (uint32_t new_phase, int i)
 {
   new_step_check_saw (new_phase, i) ;
   int32_t val = process_active_steps_saw (new_phase) ;
@@ -703,7 +1238,7 @@ int16_t BandLimitedWaveformTS::generate_sawtooth (uint32_t new_phase, int i)
   return sample ;
 }
 
-int16_t BandLimitedWaveformTS::generate_square (uint32_t new_phase, int i)
+FASTRUN int16_t BandLimitedWaveformTS::generate_square (uint32_t new_phase, int i)
 {
   new_step_check_square (new_phase, i) ;
   int32_t val = process_active_steps (new_phase) ;
@@ -713,7 +1248,7 @@ int16_t BandLimitedWaveformTS::generate_square (uint32_t new_phase, int i)
   return sample ;
 }
 
-int16_t BandLimitedWaveformTS::generate_pulse (uint32_t new_phase, uint32_t pulse_width, int i)
+FASTRUN int16_t BandLimitedWaveformTS::generate_pulse (uint32_t new_phase, uint32_t pulse_width, int i)
 {
   new_step_check_pulse (new_phase, pulse_width, i) ;
   int32_t val = process_active_steps_pulse (new_phase, pulse_width) ;
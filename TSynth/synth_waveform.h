@@ -33,6 +33,7 @@
 #include <Arduino.h>
 #include "AudioStream.h"
 #include "arm_math.h"
+#include "effect_combine.h"
 
 // waveforms.c
 extern "C" {
@@ -53,8 +54,12 @@ extern const int16_t AudioWaveformSine[257];
 #define WAVEFORM_BANDLIMIT_SAWTOOTH_REVERSE 10
 #define WAVEFORM_BANDLIMIT_SQUARE 11
 #define WAVEFORM_BANDLIMIT_PULSE  12
+#define WAVEFORM_SUPERSAW         13
 #define WAVEFORM_SILENT       19
 
+// Most saws one supersaw oscillator renders, see AudioSynthWaveformModulatedTS::supersaw()
+#define SUPERSAW_MAX_SAWS 7
+
 typedef struct step_state
 {
   int offset ;
@@ -168,7 +173,7 @@ public:
     phase_offset = 0;
     begin (t_type);
   }
-  void arbitraryWaveform(const int16_t *data, float maxFreq) {
+  void arbitraryWaveform(const int16_t *data, float /*maxFreq*/) {
     arbdata = data;
   }
   virtual void update(void);
@@ -188,13 +193,22 @@ private:
 };
 
 
-class AudioSynthWaveformModulatedTS : public AudioStream
+// The oscillator behind AudioSynthWaveformModulatedTS, without the
+// AudioStream around it, so AudioSynthWaveformDualTS can run two of them
+// in one update.
+class ModulatedOscillatorTS
 {
 public:
-  AudioSynthWaveformModulatedTS(void) : AudioStream(2, inputQueueArray),
+  ModulatedOscillatorTS(void) :
     phase_accumulator(0), phase_increment(0), modulation_factor(32768),
     magnitude(0), arbdata(NULL), sample(0), tone_offset(0),
-    tone_type(WAVEFORM_SINE), modulation_type(0), syncFlag(0) {
+    tone_type(WAVEFORM_SINE), modulation_type(0), syncFlag(0),
+    supersaw_count(0), supersaw_width(-1.0f), supersaw_spread(0.0f),
+    sync_held(0) {
+    // the supersaw steps from the last phase of the previous block
+    phasedata[AUDIO_BLOCK_SAMPLES-1] = 0;
+    supersaw(SUPERSAW_MAX_SAWS, 0.0f);
+    supersaw_reset();
   }
 
   void frequency(float freq) {
@@ -239,7 +253,7 @@ public:
     frequency(t_freq);
     begin (t_type) ;
   }
-  void arbitraryWaveform(const int16_t *data, float maxFreq) {
+  void arbitraryWaveform(const int16_t *data, float /*maxFreq*/) {
     arbdata = data;
   }
   void frequencyModulation(float octaves) {
@@ -251,6 +265,14 @@ public:
     modulation_factor = octaves * 4096.0;
     modulation_type = 0;
   }
+  // WAVEFORM_SUPERSAW: saws detuned around the oscillator frequency across
+  // width (a fraction of it, like 1 - detune in VoiceParams), placed along
+  // the DETUNE spread table. They share this oscillator's phase increment
+  // and frequency modulation, so unison costs one voice.
+  void supersaw(uint8_t saws, float width);
+  // Pan the saws apart, 0 (default) is mono on output 0; above 0 output 0
+  // is left and output 1 right
+  void supersawSpread(float spread);
   void phaseModulation(float degrees) {
     if (degrees > 9000.0) {
       degrees = 9000.0;
@@ -260,10 +282,31 @@ public:
     modulation_factor = degrees * (65536.0 / 180.0);
     modulation_type = 1;
   }
-  virtual void update(void);
+
+protected:
+  // Phase for every sample of this update from the modulation input (NULL
+  // for none, constant when the whole block is one value). Returns the
+  // phase of the previous block's last sample.
+  uint32_t phases(const int16_t *mod, bool constant);
+  // False when the waveform is silent, nothing to render
+  bool sounding(void);
+  // Output samples from the phases, right is NULL for mono. False when
+  // there is nothing to play (arbitrary waveform without data).
+  bool render(int16_t *bp, int16_t *right, const int16_t *shape, uint32_t priorphase);
+  // A spread supersaw has a right channel for output 1
+  bool stereo(void) {
+    return tone_type == WAVEFORM_SUPERSAW && supersaw_spread > 0.0f;
+  }
+  // Hard sync, see AudioSynthWaveformDualTS
+  bool syncable(void);
+  void resync(const uint32_t *master, uint32_t masterprior, uint32_t prior,
+    uint32_t *incs, int32_t *resets);
+  void render_synced(int16_t *bp, const int16_t *shape, uint32_t prior,
+    const uint32_t *incs, const int32_t *resets);
 
 private:
-  audio_block_t *inputQueueArray[2];
+  void supersaw_reset(void);
+  void update_supersaw(int16_t *left, int16_t *right, uint32_t prior);
   uint32_t phase_accumulator;
   uint32_t phase_increment;
   uint32_t modulation_factor;
@@ -276,6 +319,94 @@ private:
   uint8_t  modulation_type;
     int16_t   syncFlag;
         BandLimitedWaveformTS band_limit_waveform ;
+  uint32_t supersaw_phase[SUPERSAW_MAX_SAWS];
+  uint32_t supersaw_ratio[SUPERSAW_MAX_SAWS];  // 2.30 multiple of the phase step
+  int32_t  supersaw_left[SUPERSAW_MAX_SAWS];   // 8 bit pan weights, sum to 512
+  int32_t  supersaw_gain;                      // output gain for the saw count
+  uint8_t  supersaw_count;
+  float    supersaw_width;
+  float    supersaw_spread;
+  int32_t  sync_held;  // hard synced output runs one sample behind
+  friend class AudioSynthWaveformDualTS;
+};
+
+
+class AudioSynthWaveformModulatedTS : public AudioStream, public ModulatedOscillatorTS
+{
+public:
+  AudioSynthWaveformModulatedTS(void) : AudioStream(2, inputQueueArray) {
+  }
+  virtual void update(void);
+
+private:
+  audio_block_t *inputQueueArray[2];
+};
+
+
+// Oscillators A and B of a voice as one object, with the cross modulation,
+// hard sync and digital combine between them done inside the update. The
+// modulating oscillator is rendered first and the other reads it sample
+// for sample; patched through mixers in a loop, one of them always heard
+// the other a block late and sync wasn't possible at all.
+//
+// Inputs 0 and 1 are A's frequency modulation and shape, 2 and 3 B's.
+// Output 0 is A, B and their combination mixed at gain(0..2). Settings for
+// each oscillator go straight to a and b.
+class AudioSynthWaveformDualTS : public AudioStream
+{
+public:
+  AudioSynthWaveformDualTS(void) : AudioStream(4, inputQueueArray),
+    xmod_multiplier(0), xmod_carrier(0),
+    combine_mode(AudioEffectDigitalCombine::OFF), hard_sync(false) {
+    multiplier[0] = 65536;
+    multiplier[1] = 65536;
+    multiplier[2] = 0;
+  }
+  // Channel 0 is A, 1 is B and 2 the combination of both
+  void gain(unsigned int channel, float gain) {
+    if (channel >= 3) return;
+    if (gain > 32767.0f) gain = 32767.0f;
+    else if (gain < -32767.0f) gain = -32767.0f;
+    multiplier[channel] = gain * 65536.0f;
+  }
+  // Frequency modulation of one oscillator (0 A, 1 B) by the other's
+  // output, added to its modulation input at this gain. One direction at
+  // a time, setting one clears the other.
+  void crossModulation(uint8_t carrier, float amount) {
+    if (amount > 1.0f) amount = 1.0f;
+    else if (amount < -1.0f) amount = -1.0f;
+    xmod_carrier = carrier ? 1 : 0;
+    xmod_multiplier = amount * 65536.0f;
+  }
+  // An AudioEffectDigitalCombine mode for channel 2, OFF skips it
+  void combineMode(int mode) {
+    if (mode > AudioEffectDigitalCombine::OFF) mode = AudioEffectDigitalCombine::OFF;
+    combine_mode = mode;
+  }
+  // Restart B's cycle every time A's wraps. The resets and B's own edges
+  // are polyBLEP corrected and B plays one sample late; its band limited
+  // waveforms switch to polyBLEP versions while synced. B's supersaw and
+  // sample and hold don't sync. Cross modulation of A is ignored while
+  // syncing, A has to be rendered first.
+  void hardSync(bool enable) {
+    if (enable == hard_sync) return;
+    hard_sync = enable;
+    b.sync_held = 0;
+    // restart the band limited step generator from B's phase
+    if (!enable) b.begin(b.tone_type);
+  }
+  virtual void update(void);
+
+  ModulatedOscillatorTS a;
+  ModulatedOscillatorTS b;
+
+private:
+  int32_t multiplier[3];
+  int32_t xmod_multiplier;
+  uint8_t xmod_carrier;
+  uint8_t combine_mode;
+  bool hard_sync;
+  audio_block_t *inputQueueArray[4];
 };
 
 
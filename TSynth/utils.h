@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include <algorithm>
+#include "TextBuffer.h"
 
 // Clamp a value to the given range.
 template <typename NumericType>
@@ -12,9 +13,9 @@ NumericType inRangeOrDefault(NumericType value, NumericType defaultValue, Numeri
   return value;
 }
 
-String milliToString(float milli) {
-    if (milli < 1000) return String(int(milli)) + " ms";
-    return String(milli / 1000) + " s";
+TextBuffer<DISPLAY_CHARS> milliToString(float milli) {
+    if (milli < 1000) return text(int(milli), " ms");
+    return text(milli / 1000, " s");
 }
 
 
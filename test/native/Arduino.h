@@ -0,0 +1,25 @@
+//
+// Host stand-in for the parts of the Teensy core that the DSP sources use,
+// so native tests can compile TSynth/*.cpp audio objects directly.
+//
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define FLASHMEM
+#define FASTRUN
+#define PROGMEM
+#define DMAMEM
+#define F(x) x
+
+#define __disable_irq()
+#define __enable_irq()
+
+static inline long random(long howbig) { return howbig ? rand() % howbig : 0; }
+static inline long random(long howsmall, long howbig) { return howsmall + random(howbig - howsmall); }
+
+#endif
@@ -0,0 +1,219 @@
+//
+// Single threaded host version of the Teensy AudioStream interface. Objects
+// update in construction order, like update_all() on the Teensy, and blocks
+// come from a fixed pool so allocation failures and peak usage behave the
+// same way.
+//
+#ifndef NATIVE_AUDIOSTREAM_H
+#define NATIVE_AUDIOSTREAM_H
+
+#include <stdint.h>
+#include <string.h>
+
+#ifndef AUDIO_BLOCK_SAMPLES
+#define AUDIO_BLOCK_SAMPLES 128
+#endif
+#define AUDIO_SAMPLE_RATE_EXACT 44117.64706f
+#define AUDIO_SAMPLE_RATE AUDIO_SAMPLE_RATE_EXACT
+
+// The kernels are written for ARMv7E-M; utility/dspinst.h provides
+// portable versions of the DSP instructions they use
+#ifndef __ARM_ARCH_7EM__
+#define __ARM_ARCH_7EM__ 1
+#endif
+
+#define NATIVE_AUDIO_MAX_BLOCKS 256
+#define NATIVE_AUDIO_MAX_OBJECTS 512
+#define NATIVE_AUDIO_MAX_CONNECTIONS 1024
+
+typedef struct audio_block_struct {
+	uint8_t  ref_count;
+	uint8_t  reserved1;
+	uint16_t memory_pool_index;
+	int16_t  data[AUDIO_BLOCK_SAMPLES];
+} audio_block_t;
+
+class AudioStream;
+
+class AudioConnection
+{
+public:
+	AudioConnection() : src(NULL), dst(NULL), src_index(0), dest_index(0), isConnected(false) {}
+	AudioConnection(AudioStream &source, unsigned char sourceOutput,
+		AudioStream &destination, unsigned char destinationInput) : AudioConnection() {
+		connect(source, sourceOutput, destination, destinationInput);
+	}
+	AudioConnection(AudioStream &source, AudioStream &destination) : AudioConnection() {
+		connect(source, 0, destination, 0);
+	}
+	inline ~AudioConnection();
+	inline int connect(AudioStream &source, unsigned char sourceOutput,
+		AudioStream &destination, unsigned char destinationInput);
+	int connect(AudioStream &source, AudioStream &destination) {
+		return connect(source, 0, destination, 0);
+	}
+	inline int disconnect(void);
+protected:
+	AudioStream *src;
+	AudioStream *dst;
+	unsigned char src_index;
+	unsigned char dest_index;
+	bool isConnected;
+	friend class AudioStream;
+};
+
+class AudioStream
+{
+public:
+	AudioStream(unsigned char ninput, audio_block_t **iqueue) :
+		num_inputs(ninput), inputQueue(iqueue) {
+		active = false;
+		for (int i=0; i < num_inputs; i++) inputQueue[i] = NULL;
+		objects()[object_count()++] = this;
+		cpu_cycles = cpu_cycles_max = 0;
+	}
+	virtual ~AudioStream() {
+		unsigned int n = 0;
+		for (unsigned int i=0; i < object_count(); i++) {
+			if (objects()[i] != this) objects()[n++] = objects()[i];
+		}
+		object_count() = n;
+	}
+	static void initialize_memory(unsigned int num) {
+		if (num > NATIVE_AUDIO_MAX_BLOCKS) num = NATIVE_AUDIO_MAX_BLOCKS;
+		pool_size() = num;
+		for (unsigned int i=0; i < num; i++) {
+			pool()[i].ref_count = 0;
+			pool()[i].memory_pool_index = i;
+		}
+		memory_used() = memory_used_max() = 0;
+	}
+	static void update_all(void) {
+		for (unsigned int i=0; i < object_count(); i++) {
+			AudioStream *p = objects()[i];
+			if (p->active) p->update();
+		}
+	}
+	static unsigned int &memory_used() { static unsigned int n; return n; }
+	static unsigned int &memory_used_max() { static unsigned int n; return n; }
+	// Host only: blocks handed out by allocate() since start up
+	static unsigned int &allocation_count() { static unsigned int n; return n; }
+	// Host only: the objects update_all() runs, in its order
+	static unsigned int update_count() { return object_count(); }
+	static AudioStream *update_list(unsigned int i) { return objects()[i]; }
+	uint16_t cpu_cycles;
+	uint16_t cpu_cycles_max;
+	// Nothing counts cycles on the host, these are always 0
+	float processorUsage(void) { return cpu_cycles; }
+	float processorUsageMax(void) { return cpu_cycles_max; }
+	void processorUsageMaxReset(void) { cpu_cycles_max = cpu_cycles; }
+protected:
+	bool active;
+	unsigned char num_inputs;
+	static audio_block_t * allocate(void) {
+		for (unsigned int i=0; i < pool_size(); i++) {
+			if (pool()[i].ref_count == 0) {
+				pool()[i].ref_count = 1;
+				allocation_count()++;
+				if (++memory_used() > memory_used_max()) memory_used_max() = memory_used();
+				return &pool()[i];
+			}
+		}
+		return NULL;
+	}
+	static void release(audio_block_t *block) {
+		if (block->ref_count > 1) {
+			block->ref_count--;
+		} else if (block->ref_count == 1) {
+			block->ref_count = 0;
+			memory_used()--;
+		}
+	}
+	void transmit(audio_block_t *block, unsigned char index = 0) {
+		for (unsigned int i=0; i < connection_count(); i++) {
+			AudioConnection *c = connections()[i];
+			if (c->isConnected && c->src == this && c->src_index == index) {
+				if (c->dst->inputQueue[c->dest_index] == NULL) {
+					c->dst->inputQueue[c->dest_index] = block;
+					block->ref_count++;
+				}
+			}
+		}
+	}
+	audio_block_t * receiveReadOnly(unsigned int index = 0) {
+		if (index >= num_inputs) return NULL;
+		audio_block_t *in = inputQueue[index];
+		inputQueue[index] = NULL;
+		return in;
+	}
+	audio_block_t * receiveWritable(unsigned int index = 0) {
+		audio_block_t *in = receiveReadOnly(index);
+		if (in && in->ref_count > 1) {
+			audio_block_t *p = allocate();
+			if (p) memcpy(p->data, in->data, sizeof(p->data));
+			in->ref_count--;
+			in = p;
+		}
+		return in;
+	}
+	virtual void update(void) = 0;
+	friend class AudioConnection;
+private:
+	audio_block_t **inputQueue;
+	static AudioStream **objects() { static AudioStream *list[NATIVE_AUDIO_MAX_OBJECTS]; return list; }
+	static unsigned int &object_count() { static unsigned int n; return n; }
+	static audio_block_t *pool() { static audio_block_t blocks[NATIVE_AUDIO_MAX_BLOCKS]; return blocks; }
+	static unsigned int &pool_size() { static unsigned int n; return n; }
+	static AudioConnection **connections() { static AudioConnection *list[NATIVE_AUDIO_MAX_CONNECTIONS]; return list; }
+	static unsigned int &connection_count() { static unsigned int n; return n; }
+};
+
+inline int AudioConnection::connect(AudioStream &source, unsigned char sourceOutput,
+	AudioStream &destination, unsigned char destinationInput)
+{
+	if (isConnected) return 1;
+	if (destinationInput >= destination.num_inputs) return 2;
+	src = &source;
+	dst = &destination;
+	src_index = sourceOutput;
+	dest_index = destinationInput;
+	isConnected = true;
+	source.active = true;
+	destination.active = true;
+	for (unsigned int i=0; i < AudioStream::connection_count(); i++) {
+		if (AudioStream::connections()[i] == this) return 0;
+	}
+	AudioStream::connections()[AudioStream::connection_count()++] = this;
+	return 0;
+}
+
+inline AudioConnection::~AudioConnection()
+{
+	disconnect();
+	unsigned int n = 0;
+	for (unsigned int i=0; i < AudioStream::connection_count(); i++) {
+		if (AudioStream::connections()[i] != this) {
+			AudioStream::connections()[n++] = AudioStream::connections()[i];
+		}
+	}
+	AudioStream::connection_count() = n;
+}
+
+inline int AudioConnection::disconnect(void)
+{
+	if (!isConnected) return 1;
+	isConnected = false;
+	audio_block_t *queued = dst->inputQueue[dest_index];
+	if (queued) {
+		dst->inputQueue[dest_index] = NULL;
+		AudioStream::release(queued);
+	}
+	return 0;
+}
+
+#define AudioMemory(num) AudioStream::initialize_memory(num)
+#define AudioMemoryUsage() (AudioStream::memory_used())
+#define AudioMemoryUsageMax() (AudioStream::memory_used_max())
+#define AudioMemoryUsageMaxReset() (AudioStream::memory_used_max() = AudioStream::memory_used())
+
+#endif
@@ -0,0 +1,70 @@
+//
+// Minimal sources and sinks for driving audio objects in native tests.
+//
+#ifndef NATIVE_AUDIO_TEST_NODES_H
+#define NATIVE_AUDIO_TEST_NODES_H
+
+#include <vector>
+#include "AudioStream.h"
+
+// Updates taking as long as n blocks of 128 samples, so a test runs for the
+// same time whatever AUDIO_BLOCK_SAMPLES it's built with
+static inline int blocksOf128(int n)
+{
+	return n * 128 / AUDIO_BLOCK_SAMPLES;
+}
+
+// Emits one block per update from a sample generator; t counts samples
+// from the first update
+class AudioTestSource : public AudioStream
+{
+public:
+	typedef int16_t (*Generator)(uint32_t t, void *context);
+
+	AudioTestSource(Generator g, void *c = NULL) : AudioStream(0, NULL),
+		generator(g), context(c), t(0), silent(false) {
+		active = true;
+	}
+	void setSilent(bool s) { silent = s; }
+	virtual void update(void) {
+		if (silent) {
+			t += AUDIO_BLOCK_SAMPLES;
+			return;
+		}
+		audio_block_t *block = allocate();
+		if (!block) return;
+		for (int i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			block->data[i] = generator(t++, context);
+		}
+		transmit(block);
+		release(block);
+	}
+private:
+	Generator generator;
+	void *context;
+	uint32_t t;
+	bool silent;
+};
+
+// Records everything it receives; a missing block is recorded as silence
+class AudioTestSink : public AudioStream
+{
+public:
+	AudioTestSink() : AudioStream(1, inputQueueArray), missing(0) {}
+	virtual void update(void) {
+		audio_block_t *block = receiveReadOnly(0);
+		if (!block) {
+			missing++;
+			samples.insert(samples.end(), AUDIO_BLOCK_SAMPLES, 0);
+			return;
+		}
+		samples.insert(samples.end(), block->data, block->data + AUDIO_BLOCK_SAMPLES);
+		release(block);
+	}
+	std::vector<int16_t> samples;
+	unsigned int missing;
+private:
+	audio_block_t *inputQueueArray[1];
+};
+
+#endif
@@ -0,0 +1,7 @@
+//
+// Empty stand-in for CMSIS arm_math.h, which the audio objects include but
+// do not use.
+//
+#ifndef NATIVE_ARM_MATH_H
+#define NATIVE_ARM_MATH_H
+#endif
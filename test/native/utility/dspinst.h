@@ -0,0 +1,155 @@
+//
+// Portable versions of the Cortex-M4/M7 DSP helpers from the Teensy audio
+// library's utility/dspinst.h, for native builds of the audio objects.
+//
+#ifndef NATIVE_DSPINST_H
+#define NATIVE_DSPINST_H
+
+#include <stdint.h>
+
+// computes limit((val >> rshift), 2**bits)
+static inline int32_t signed_saturate_rshift(int32_t val, int bits, int rshift)
+{
+	int32_t out = val >> rshift;
+	const int32_t max = (1 << (bits - 1)) - 1;
+	if (out > max) return max;
+	if (out < -max - 1) return -max - 1;
+	return out;
+}
+
+// computes ((a[31:0] * b[15:0]) >> 16)
+static inline int32_t signed_multiply_32x16b(int32_t a, uint32_t b)
+{
+	return ((int64_t)a * (int16_t)(b & 0xFFFF)) >> 16;
+}
+
+// computes ((a[31:0] * b[31:16]) >> 16)
+static inline int32_t signed_multiply_32x16t(int32_t a, uint32_t b)
+{
+	return ((int64_t)a * (int16_t)(b >> 16)) >> 16;
+}
+
+// computes (((int64_t)a[31:0] * (int64_t)b[31:0]) >> 32)
+static inline int32_t multiply_32x32_rshift32(int32_t a, int32_t b)
+{
+	return ((int64_t)a * (int64_t)b) >> 32;
+}
+
+// computes (((int64_t)a[31:0] * (int64_t)b[31:0] + 0x80000000) >> 32)
+static inline int32_t multiply_32x32_rshift32_rounded(int32_t a, int32_t b)
+{
+	return ((int64_t)a * (int64_t)b + 0x80000000LL) >> 32;
+}
+
+// computes sum + (((int64_t)a[31:0] * (int64_t)b[31:0] + 0x80000000) >> 32)
+static inline int32_t multiply_accumulate_32x32_rshift32_rounded(int32_t sum, int32_t a, int32_t b)
+{
+	return sum + (int32_t)(((int64_t)a * (int64_t)b + 0x80000000LL) >> 32);
+}
+
+// computes sum - (((int64_t)a[31:0] * (int64_t)b[31:0] + 0x80000000) >> 32)
+static inline int32_t multiply_subtract_32x32_rshift32_rounded(int32_t sum, int32_t a, int32_t b)
+{
+	return sum - (int32_t)(((int64_t)a * (int64_t)b + 0x80000000LL) >> 32);
+}
+
+// computes (a[31:16] | b[31:16])
+static inline uint32_t pack_16t_16t(int32_t a, int32_t b)
+{
+	return ((uint32_t)a & 0xFFFF0000) | ((uint32_t)b >> 16);
+}
+
+// computes (a[31:16] | b[15:0])
+static inline uint32_t pack_16t_16b(int32_t a, int32_t b)
+{
+	return ((uint32_t)a & 0xFFFF0000) | ((uint32_t)b & 0x0000FFFF);
+}
+
+// computes (a[15:0] << 16) | b[15:0]
+static inline uint32_t pack_16b_16b(int32_t a, int32_t b)
+{
+	return ((uint32_t)a << 16) | ((uint32_t)b & 0x0000FFFF);
+}
+
+// computes (a[15:0] << 16) | b[15:0]
+static inline uint32_t pack_16x16(int32_t a, int32_t b)
+{
+	return pack_16b_16b(a, b);
+}
+
+// computes (((a[31:16] + b[31:16]) << 16) | (a[15:0 + b[15:0]))  (saturates)
+static inline uint32_t signed_add_16_and_16(uint32_t a, uint32_t b)
+{
+	int32_t lo = (int16_t)a + (int16_t)b;
+	int32_t hi = (int16_t)(a >> 16) + (int16_t)(b >> 16);
+	lo = lo > 32767 ? 32767 : (lo < -32768 ? -32768 : lo);
+	hi = hi > 32767 ? 32767 : (hi < -32768 ? -32768 : hi);
+	return ((uint32_t)(uint16_t)hi << 16) | (uint16_t)lo;
+}
+
+// computes (((a[31:16] - b[31:16]) << 16) | (a[15:0 - b[15:0]))  (saturates)
+static inline uint32_t signed_subtract_16_and_16(uint32_t a, uint32_t b)
+{
+	int32_t lo = (int16_t)a - (int16_t)b;
+	int32_t hi = (int16_t)(a >> 16) - (int16_t)(b >> 16);
+	lo = lo > 32767 ? 32767 : (lo < -32768 ? -32768 : lo);
+	hi = hi > 32767 ? 32767 : (hi < -32768 ? -32768 : hi);
+	return ((uint32_t)(uint16_t)hi << 16) | (uint16_t)lo;
+}
+
+// computes (a[15:0] * b[15:0])
+static inline int32_t multiply_16bx16b(uint32_t a, uint32_t b)
+{
+	return (int16_t)a * (int16_t)b;
+}
+
+// computes (a[15:0] * b[31:16])
+static inline int32_t multiply_16bx16t(uint32_t a, uint32_t b)
+{
+	return (int16_t)a * (int16_t)(b >> 16);
+}
+
+// computes (a[31:16] * b[15:0])
+static inline int32_t multiply_16tx16b(uint32_t a, uint32_t b)
+{
+	return (int16_t)(a >> 16) * (int16_t)b;
+}
+
+// computes (a[31:16] * b[31:16])
+static inline int32_t multiply_16tx16t(uint32_t a, uint32_t b)
+{
+	return (int16_t)(a >> 16) * (int16_t)(b >> 16);
+}
+
+// computes (a[31:16] * b[31:16]) + (a[15:0] * b[15:0])
+static inline int32_t multiply_16tx16t_add_16bx16b(uint32_t a, uint32_t b)
+{
+	return multiply_16tx16t(a, b) + multiply_16bx16b(a, b);
+}
+
+// computes (a[31:16] * b[15:0]) + (a[15:0] * b[31:16])
+static inline int32_t multiply_16tx16b_add_16bx16t(uint32_t a, uint32_t b)
+{
+	return multiply_16tx16b(a, b) + multiply_16bx16t(a, b);
+}
+
+// computes saturate(a - b)
+static inline int32_t substract_32_saturate(uint32_t a, uint32_t b)
+{
+	int64_t out = (int64_t)(int32_t)a - (int32_t)b;
+	if (out > INT32_MAX) return INT32_MAX;
+	if (out < INT32_MIN) return INT32_MIN;
+	return out;
+}
+
+// Q flag is not modelled on the host
+static inline uint32_t get_q_psr(void)
+{
+	return 0;
+}
+
+static inline void clr_q_psr(void)
+{
+}
+
+#endif
@@ -0,0 +1,144 @@
+//
+// AudioSynthWaveformDcTS read as a control rate signal by AudioMixer4TS,
+// against the same source transmitting audio blocks into the mixer.
+//
+#include <unity.h>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <math.h>
+#include "AudioTestNodes.h"
+#include "../../TSynth/block_tags.cpp"
+#include "../../TSynth/synth_dc.cpp"
+#include "../../TSynth/mixer_ts.cpp"
+
+static const int VOICES = 12;
+
+void setUp() {}
+void tearDown() {}
+
+// An LFO-like modulation already on the mixer, as the filter envelope or
+// pitch LFO would be
+static int16_t lfo(uint32_t t, void *context)
+{
+    return (int16_t)(8000.0f * sinf(2.0f * (float)M_PI * 5.0f * t / AUDIO_SAMPLE_RATE_EXACT));
+}
+
+// One oscModMixer: audio on channel 0, glide on channel 2
+struct ModPath
+{
+    AudioTestSource audio{lfo};
+    AudioSynthWaveformDcTS dc;
+    AudioMixer4TS mixer;
+    AudioTestSink out;
+    AudioConnection c0{audio, 0, mixer, 0};
+    AudioConnection c1;
+    AudioConnection c2{mixer, 0, out, 0};
+
+    ModPath(bool control)
+    {
+        mixer.gain(0, 0.5f);
+        mixer.gain(2, 0.7f);
+        if (control)
+            mixer.control(2, dc.controlSignal());
+        else
+            c1.connect(dc, 0, mixer, 2);
+    }
+
+    // Host microseconds per audio block
+    double run(int blocks)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int b = 0; b < blocks; b++)
+            AudioStream::update_all();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / blocks;
+    }
+};
+
+// Held level, then a note change with the glide Voice::noteOn() sets up
+static void play(ModPath &path, uint8_t glideMode)
+{
+    path.dc.setMode(glideMode);
+    path.dc.amplitude(0.3f);
+    path.run(20);
+    path.dc.amplitude(-0.25f);
+    path.dc.amplitude(0, 40.0f);
+    path.run(40);
+}
+
+void test_held_level_is_exact()
+{
+    AudioMemory(16);
+    std::vector<int16_t> reference;
+    {
+        ModPath path(false);
+        path.dc.amplitude(0.3f);
+        path.run(20);
+        reference = path.out.samples;
+    }
+    ModPath path(true);
+    path.dc.amplitude(0.3f);
+    path.run(20);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(reference.data(), path.out.samples.data(), reference.size());
+}
+
+void test_glide_follows_block_output()
+{
+    AudioMemory(16);
+    const uint8_t modes[] = {AudioSynthWaveformDcTS::GLIDE_LIN, AudioSynthWaveformDcTS::GLIDE_EXP};
+    for (uint8_t mode : modes)
+    {
+        std::vector<int16_t> reference;
+        {
+            ModPath path(false);
+            play(path, mode);
+            reference = path.out.samples;
+        }
+        ModPath path(true);
+        play(path, mode);
+        int worst = 0;
+        for (size_t i = 0; i < reference.size(); i++)
+            worst = std::max(worst, abs(path.out.samples[i] - reference[i]));
+        std::cout << (mode == AudioSynthWaveformDcTS::GLIDE_LIN ? "linear" : "exponential")
+                  << " glide, largest difference from block output: " << worst << std::endl;
+        // A control signal is a straight line across each block; the glide
+        // only bends within the block where it lands on the target
+        TEST_ASSERT_LESS_THAN(128, worst);
+    }
+}
+
+void test_block_traffic_and_timing()
+{
+    AudioMemory(64);
+    const char *names[] = {"audio blocks", "control rate"};
+    unsigned int blocks[2];
+    for (int control = 0; control < 2; control++)
+    {
+        ModPath *paths[VOICES];
+        for (int v = 0; v < VOICES; v++)
+        {
+            paths[v] = new ModPath(control);
+            paths[v]->dc.amplitude(v / 24.0f);
+        }
+        const unsigned int before = AudioStream::allocation_count();
+        const double us = paths[0]->run(400);
+        blocks[control] = (AudioStream::allocation_count() - before) / 400;
+        std::cout << std::setw(12) << names[control] << ": " << std::fixed << std::setprecision(2) << us
+                  << " us/block, " << blocks[control] << " blocks allocated per update (" << VOICES
+                  << " voices, including the test sources)" << std::endl;
+        for (int v = 0; v < VOICES; v++)
+            delete paths[v];
+    }
+    // One block less per voice: the DC source no longer allocates
+    TEST_ASSERT_EQUAL_UINT(blocks[0] - VOICES, blocks[1]);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_held_level_is_exact);
+    RUN_TEST(test_glide_follows_block_output);
+    RUN_TEST(test_block_traffic_and_timing);
+    UNITY_END();
+}
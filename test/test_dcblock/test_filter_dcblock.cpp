@@ -0,0 +1,165 @@
+//
+// AudioFilterDCBlockTS against the 12Hz state variable highpass it replaced:
+// magnitude response, DC removal and host timing.
+//
+#include <unity.h>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <math.h>
+#include "AudioTestNodes.h"
+#include "../../TSynth/block_tags.cpp"
+#include "../../TSynth/filter_variable.cpp"
+#include "../../TSynth/filter_dcblock.cpp"
+
+void setUp() {}
+void tearDown() {}
+
+static int16_t sine(uint32_t t, void *context)
+{
+    const float freq = *(float *)context;
+    return (int16_t)(16000.0f * sinf(2.0f * (float)M_PI * freq * t / AUDIO_SAMPLE_RATE_EXACT));
+}
+
+// Two unison pulse waves, both well off centre, as the voice mixer might sum them
+static int16_t pulses(uint32_t t, void *context)
+{
+    const float a = fmodf(t * 110.0f / AUDIO_SAMPLE_RATE_EXACT, 1.0f);
+    const float b = fmodf(t * 110.6f / AUDIO_SAMPLE_RATE_EXACT, 1.0f);
+    return (a < 0.1f ? 9000 : -1000) + (b < 0.15f ? 9000 : -1500);
+}
+
+static int16_t held(uint32_t t, void *context)
+{
+    return 20000;
+}
+
+template <class Filter>
+struct Chain
+{
+    AudioTestSource source;
+    Filter filter;
+    AudioTestSink out;
+    AudioConnection c0{source, 0, filter, 0};
+    AudioConnection c1;
+
+    Chain(AudioTestSource::Generator g, void *context = NULL) : source(g, context)
+    {
+        filter.frequency(12.0f);
+        connectOutput();
+    }
+    void connectOutput();
+
+    // Host microseconds per audio block, counted in blocks of 128 samples
+    // so the time covers the same audio at any block size
+    double run(int blocks)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int b = 0; b < blocksOf128(blocks); b++)
+            AudioStream::update_all();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / blocks;
+    }
+};
+
+// The old dcOffsetFilter setup: highpass output, no control input
+template <>
+void Chain<AudioFilterStateVariableTS>::connectOutput()
+{
+    filter.octaveControl(1.0f);
+    c1.connect(filter, 2, out, 0);
+}
+
+template <>
+void Chain<AudioFilterDCBlockTS>::connectOutput()
+{
+    c1.connect(filter, 0, out, 0);
+}
+
+// Gain in dB of the last second of output for a 16000 amplitude sine
+template <class Filter>
+static double gainDb(float freq)
+{
+    Chain<Filter> chain(sine, &freq);
+    chain.run(1000);
+    const std::vector<int16_t> &s = chain.out.samples;
+    const size_t n = (size_t)AUDIO_SAMPLE_RATE_EXACT;
+    double sum = 0;
+    for (size_t i = s.size() - n; i < s.size(); i++)
+        sum += (double)s[i] * s[i];
+    return 20.0 * log10(sqrt(sum / n) / (16000.0 / sqrt(2.0)));
+}
+
+void test_response_against_state_variable()
+{
+    AudioMemory(8);
+    const float freqs[] = {3.0f, 6.0f, 12.0f, 24.0f, 50.0f, 100.0f, 1000.0f, 10000.0f};
+    std::cout << "   Hz | state variable dB | dc block dB" << std::endl;
+    for (float f : freqs)
+    {
+        const double svf = gainDb<AudioFilterStateVariableTS>(f);
+        const double dc = gainDb<AudioFilterDCBlockTS>(f);
+        std::cout << std::setw(5) << f << " | " << std::setw(17) << std::fixed << std::setprecision(2) << svf
+                  << " | " << std::setw(11) << dc << std::endl;
+        if (f == 12.0f)
+            TEST_ASSERT_FLOAT_WITHIN(0.2, -3.01, dc);
+        // First order, so a gentler slope below the corner, but still flat
+        // through the audible range
+        if (f >= 100.0f)
+            TEST_ASSERT_FLOAT_WITHIN(0.1, 0.0, dc);
+    }
+}
+
+void test_removes_dc()
+{
+    AudioMemory(8);
+    Chain<AudioFilterDCBlockTS> chain(pulses);
+    chain.run(1000);
+    const std::vector<int16_t> &s = chain.out.samples;
+    // Over whole periods of the 0.6Hz beat, the last 5 seconds
+    const size_t n = (size_t)(5.0f * AUDIO_SAMPLE_RATE_EXACT);
+    double mean = 0;
+    for (size_t i = s.size() - n; i < s.size(); i++)
+        mean += s[i];
+    mean /= n;
+    std::cout << "mean of unison pulses after dc block: " << mean << std::endl;
+    TEST_ASSERT_FLOAT_WITHIN(2.0, 0.0, mean);
+
+    // A held level decays all the way to zero
+    Chain<AudioFilterDCBlockTS> level(held);
+    level.run(1000);
+    TEST_ASSERT_EQUAL_INT16(0, level.out.samples.back());
+}
+
+void test_timing()
+{
+    AudioMemory(8);
+    // Averaged over 12 runs of the pair, both running the same signal
+    float freq = 220.0f;
+    Chain<AudioFilterStateVariableTS> svf(sine, &freq);
+    svf.source.setSilent(true);
+    Chain<AudioFilterDCBlockTS> dc(sine, &freq);
+    dc.source.setSilent(true);
+    double us[2] = {0, 0};
+    for (int r = 0; r < 12; r++)
+    {
+        svf.source.setSilent(false);
+        us[0] += svf.run(200);
+        svf.source.setSilent(true);
+        dc.source.setSilent(false);
+        us[1] += dc.run(200);
+        dc.source.setSilent(true);
+    }
+    // for information only, host wall clock time is no test of the Teensy
+    std::cout << "host us/block including source and sink: state variable " << us[0] / 12 << ", dc block "
+              << us[1] / 12 << std::endl;
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_response_against_state_variable);
+    RUN_TEST(test_removes_dc);
+    RUN_TEST(test_timing);
+    UNITY_END();
+}
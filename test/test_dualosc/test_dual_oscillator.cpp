@@ -0,0 +1,210 @@
+//
+// AudioSynthWaveformDualTS against the same two oscillators patched through
+// mixers: the same samples without cross modulation, cross modulation
+// from the modulator's current block where the patched loop heard it a
+// block late, and hard sync with band limited resets.
+//
+#include <unity.h>
+#include <iostream>
+#include <complex>
+#include <math.h>
+#include "AudioTestNodes.h"
+#include "../../TSynth/block_tags.cpp"
+#include "../../TSynth/Detune.cpp"
+#include "../../TSynth/mixer_ts.cpp"
+#include "../../TSynth/synth_waveform.cpp"
+
+// Tables from the Teensy Audio library, the waveforms used here don't
+// read them
+extern "C" {
+const int16_t AudioWaveformSine[257] = {0};
+const int16_t step_table[258] = {0};
+}
+
+static const int FFT_SIZE = 4096;
+
+void setUp() {}
+void tearDown() {}
+
+// A slow vibrato, as the pitch LFO would send
+static int16_t vibrato(uint32_t t, void *context)
+{
+    return (int16_t)(3000.0f * sinf(2.0f * (float)M_PI * 5.0f * t / AUDIO_SAMPLE_RATE_EXACT));
+}
+
+static void run(int blocks)
+{
+    for (int b = 0; b < blocksOf128(blocks); b++)
+        AudioStream::update_all();
+}
+
+static void setup(ModulatedOscillatorTS &osc, float freq, short type)
+{
+    osc.frequencyModulation(2.0f);
+    osc.begin(1.0f, freq, type);
+}
+
+void test_matches_patched_oscillators()
+{
+    AudioMemory(32);
+    AudioTestSource lfo(vibrato);
+    // as patched before: two oscillators into a mixer
+    AudioSynthWaveformModulatedTS oscA, oscB;
+    AudioMixer4TS mixer;
+    AudioTestSink patchedOut, outA, outB;
+    AudioConnection p0(lfo, 0, oscA, 0);
+    AudioConnection p1(lfo, 0, oscB, 0);
+    AudioConnection p2(oscA, 0, mixer, 0);
+    AudioConnection p3(oscB, 0, mixer, 1);
+    AudioConnection p4(mixer, 0, patchedOut, 0);
+    AudioConnection p5(oscA, 0, outA, 0);
+    AudioConnection p6(oscB, 0, outB, 0);
+    setup(oscA, 220.0f, WAVEFORM_SAWTOOTH);
+    setup(oscB, 331.0f, WAVEFORM_TRIANGLE);
+    mixer.gain(0, 0.8f);
+    mixer.gain(1, 0.6f);
+
+    AudioSynthWaveformDualTS dual, combined;
+    AudioTestSink dualOut, combinedOut;
+    AudioConnection d0(lfo, 0, dual, 0);
+    AudioConnection d1(lfo, 0, dual, 2);
+    AudioConnection d2(dual, 0, dualOut, 0);
+    AudioConnection d3(lfo, 0, combined, 0);
+    AudioConnection d4(lfo, 0, combined, 2);
+    AudioConnection d5(combined, 0, combinedOut, 0);
+    setup(dual.a, 220.0f, WAVEFORM_SAWTOOTH);
+    setup(dual.b, 331.0f, WAVEFORM_TRIANGLE);
+    dual.gain(0, 0.8f);
+    dual.gain(1, 0.6f);
+    setup(combined.a, 220.0f, WAVEFORM_SAWTOOTH);
+    setup(combined.b, 331.0f, WAVEFORM_TRIANGLE);
+    combined.gain(0, 0.0f);
+    combined.gain(1, 0.0f);
+    combined.gain(2, 0.5f);
+    combined.combineMode(AudioEffectDigitalCombine::XOR);
+
+    run(50);
+    TEST_ASSERT_EQUAL_INT(patchedOut.samples.size(), dualOut.samples.size());
+    TEST_ASSERT_EQUAL_INT16_ARRAY(patchedOut.samples.data(), dualOut.samples.data(), patchedOut.samples.size());
+    for (size_t i = 0; i < outA.samples.size(); i++)
+    {
+        const int16_t x = outA.samples[i] ^ outB.samples[i];
+        TEST_ASSERT_EQUAL_INT16(x >> 1, combinedOut.samples[i]);
+    }
+}
+
+void test_cross_mod_is_sample_exact()
+{
+    AudioMemory(32);
+    AudioTestSource lfo(vibrato);
+    // the modulator updated first, so the carrier reads its current block
+    AudioSynthWaveformModulatedTS modulator;
+    AudioMixer4TS modMixer;
+    AudioSynthWaveformModulatedTS carrier;
+    AudioTestSink exactOut;
+    AudioConnection e0(lfo, 0, modulator, 0);
+    AudioConnection e1(lfo, 0, modMixer, 0);
+    AudioConnection e2(modulator, 0, modMixer, 3);
+    AudioConnection e3(modMixer, 0, carrier, 0);
+    AudioConnection e4(carrier, 0, exactOut, 0);
+    setup(modulator, 331.0f, WAVEFORM_TRIANGLE);
+    setup(carrier, 220.0f, WAVEFORM_SAWTOOTH);
+    modMixer.gain(3, 0.5f);
+
+    // the patched loop: A's modulation mixer updates before B does
+    AudioMixer4TS loopMixer;
+    AudioSynthWaveformModulatedTS loopA, loopB;
+    AudioTestSink loopOut;
+    AudioConnection l0(lfo, 0, loopB, 0);
+    AudioConnection l1(lfo, 0, loopMixer, 0);
+    AudioConnection l2(loopB, 0, loopMixer, 3);
+    AudioConnection l3(loopMixer, 0, loopA, 0);
+    AudioConnection l4(loopA, 0, loopOut, 0);
+    setup(loopB, 331.0f, WAVEFORM_TRIANGLE);
+    setup(loopA, 220.0f, WAVEFORM_SAWTOOTH);
+    loopMixer.gain(3, 0.5f);
+
+    AudioSynthWaveformDualTS dual;
+    AudioTestSink dualOut;
+    AudioConnection d0(lfo, 0, dual, 0);
+    AudioConnection d1(lfo, 0, dual, 2);
+    AudioConnection d2(dual, 0, dualOut, 0);
+    setup(dual.a, 220.0f, WAVEFORM_SAWTOOTH);
+    setup(dual.b, 331.0f, WAVEFORM_TRIANGLE);
+    dual.gain(1, 0.0f);
+    dual.crossModulation(0, 0.5f);
+
+    run(50);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(exactOut.samples.data(), dualOut.samples.data(), exactOut.samples.size());
+    int worst = 0;
+    for (size_t i = 0; i < loopOut.samples.size(); i++)
+        worst = std::max(worst, abs(loopOut.samples[i] - dualOut.samples[i]));
+    std::cout << "patched loop, a block late: max difference " << worst << std::endl;
+    TEST_ASSERT_GREATER_THAN(1000, worst);
+}
+
+// Energy away from the harmonics of f, relative to the energy on them, in
+// dB. Hann windowed DFT, harmonics take the 4 bins either side.
+static double aliasingDb(const int16_t *x, double f)
+{
+    double harmonic = 0, alias = 0;
+    const double binHz = AUDIO_SAMPLE_RATE_EXACT / FFT_SIZE;
+    for (int k = 1; k < FFT_SIZE / 2; k++)
+    {
+        std::complex<double> sum = 0;
+        for (int n = 0; n < FFT_SIZE; n++)
+        {
+            const double w = 0.5 - 0.5 * cos(2 * M_PI * n / FFT_SIZE);
+            sum += w * x[n] * std::polar(1.0, -2 * M_PI * k * n / FFT_SIZE);
+        }
+        const double h = k * binHz / f;
+        const bool onHarmonic = fabs(h - round(h)) * f < 4.5 * binHz;
+        (onHarmonic ? harmonic : alias) += std::norm(sum);
+    }
+    return 10.0 * log10(alias / harmonic);
+}
+
+void test_hard_sync_is_band_limited()
+{
+    AudioMemory(16);
+    const float master = 1234.0f, slave = master * 2.63f;
+    const short types[] = {WAVEFORM_BANDLIMIT_SAWTOOTH, WAVEFORM_BANDLIMIT_SQUARE, WAVEFORM_TRIANGLE};
+    for (short type : types)
+    {
+        AudioSynthWaveformDualTS dual;
+        AudioTestSink out;
+        AudioConnection c(dual, 0, out, 0);
+        dual.a.begin(1.0f, master, WAVEFORM_SILENT);
+        dual.b.begin(1.0f, slave, type);
+        dual.hardSync(true);
+        run(40);
+        const double blep = aliasingDb(&out.samples[out.samples.size() - FFT_SIZE], master);
+
+        // the same waveform hard reset, nothing band limited
+        std::vector<int16_t> naive(out.samples.size());
+        const uint32_t incA = master * (4294967296.0 / AUDIO_SAMPLE_RATE_EXACT);
+        const uint32_t incB = slave * (4294967296.0 / AUDIO_SAMPLE_RATE_EXACT);
+        uint32_t phA = 0, phB = 0;
+        for (size_t i = 0; i < naive.size(); i++)
+        {
+            phA += incA;
+            phB = phA < incA ? (uint32_t)(((uint64_t)incB * phA) / incA) : phB + incB;
+            naive[i] = sync_value(type, phB, 0x80000000u, NULL);
+        }
+        const double hard = aliasingDb(&naive[naive.size() - FFT_SIZE], master);
+        std::cout << "waveform " << type << " hard synced at " << master << "Hz: naive " << hard
+                  << " dB, polyBLEP " << blep << " dB" << std::endl;
+        // the triangle keeps the corner in its slope at each reset, only
+        // the step is corrected
+        TEST_ASSERT_LESS_THAN(hard - (type == WAVEFORM_TRIANGLE ? 3.0 : 10.0), blep);
+    }
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_matches_patched_oscillators);
+    RUN_TEST(test_cross_mod_is_sample_exact);
+    RUN_TEST(test_hard_sync_is_band_limited);
+    UNITY_END();
+}
@@ -0,0 +1,266 @@
+//
+// Fixed point AudioEffectEnsemble against the previous float implementation,
+// with host timing for both, and sleeping while silent or bypassed.
+//
+#include <unity.h>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <math.h>
+#include "AudioTestNodes.h"
+#include "../../TSynth/effect_ensemble.cpp"
+
+static const int BLOCKS = 2000;
+
+void setUp() {}
+void tearDown() {}
+
+// The float version this replaced: six taps stepping through a 5880 entry
+// LFO table every countsPerLfo + 1 samples, each read with float linear
+// interpolation and round()
+class LegacyEnsemble : public AudioStream
+{
+public:
+    LegacyEnsemble() : AudioStream(1, inputQueueArray)
+    {
+        memset(delayBuffer, 0, sizeof(delayBuffer));
+        for (int i = 0; i < LFO_SIZE; i++)
+            lfoTable[i] = (sin(((2.0 * M_PI) / LFO_SIZE) * i) * LFO_RANGE) / 2.0 +
+                          (sin(((20.0 * M_PI) / LFO_SIZE) * i) * LFO_RANGE) / 3.0;
+        for (int k = 0; k < ENSEMBLE_TAPS; k++)
+            lfoIndex[k] = k * LFO_TAP_SPACING;
+    }
+    void lfoRate(float rate)
+    {
+        countsPerLfo = round((COUNTS_PER_LFO * 6) / rate);
+        if (countsPerLfo < 1)
+            countsPerLfo = 1;
+    }
+    virtual void update(void)
+    {
+        audio_block_t *block = receiveReadOnly(0);
+        audio_block_t *outblock = allocate();
+        audio_block_t *outblockB = allocate();
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+        {
+            if (++inIndex > ENSEMBLE_BUFFER_SIZE - 1)
+                inIndex = 0;
+            delayBuffer[inIndex] = block ? block->data[i] : 0;
+        }
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+        {
+            if (++lfoCount > countsPerLfo)
+            {
+                for (int k = 0; k < ENSEMBLE_TAPS; k++)
+                    if (++lfoIndex[k] > LFO_SIZE - 1)
+                        lfoIndex[k] = 0;
+                lfoCount = 0;
+            }
+            if (++outIndex > ENSEMBLE_BUFFER_SIZE - 1)
+                outIndex = 0;
+            int32_t sum = 0, sumB = 0;
+            for (int k = 0; k < ENSEMBLE_TAPS; k++)
+            {
+                sum += interpBuffer((float)outIndex + lfoTable[lfoIndex[k]]);
+                sumB += interpBuffer((float)outIndex + lfoTable[lfoIndex[k]] + PHASE_90);
+            }
+            outblock->data[i] = sum / 6;
+            outblockB->data[i] = sumB / 6;
+        }
+        transmit(outblock, 0);
+        transmit(outblockB, 1);
+        release(outblock);
+        release(outblockB);
+        if (block)
+            release(block);
+    }
+
+private:
+    int16_t interpBuffer(float findex)
+    {
+        float fintIndex;
+        float frac = modff(findex, &fintIndex);
+        int16_t index1 = (int16_t)fintIndex;
+        if (index1 > ENSEMBLE_BUFFER_SIZE - 1)
+            index1 -= ENSEMBLE_BUFFER_SIZE;
+        else if (index1 < 0)
+            index1 += ENSEMBLE_BUFFER_SIZE;
+        int16_t index2 = index1 + 1;
+        if (index2 > ENSEMBLE_BUFFER_SIZE - 1)
+            index2 -= ENSEMBLE_BUFFER_SIZE;
+        float y0 = delayBuffer[index1];
+        float y1 = delayBuffer[index2];
+        return (int16_t)round(y0 + frac * (y1 - y0));
+    }
+    audio_block_t *inputQueueArray[1];
+    int16_t delayBuffer[ENSEMBLE_BUFFER_SIZE];
+    float lfoTable[LFO_SIZE];
+    int16_t inIndex = 0;
+    int16_t outIndex = ENSEMBLE_BUFFER_SIZE / 2;
+    int16_t lfoIndex[ENSEMBLE_TAPS];
+    int lfoCount = 0;
+    int countsPerLfo = COUNTS_PER_LFO;
+};
+
+// A few partials of a string pad; the two versions place each tap up to a
+// fraction of a sample apart, which a smooth signal keeps small
+static int16_t strings(uint32_t t, void *context)
+{
+    const float s = t / AUDIO_SAMPLE_RATE_EXACT;
+    return (int16_t)(9000.0f * sinf(2.0f * (float)M_PI * 220.0f * s) +
+                     6000.0f * sinf(2.0f * (float)M_PI * 330.7f * s) +
+                     4000.0f * sinf(2.0f * (float)M_PI * 881.0f * s));
+}
+
+static int16_t dc(uint32_t t, void *context)
+{
+    return -12345;
+}
+
+template <class Ensemble>
+struct Chain
+{
+    AudioTestSource source;
+    Ensemble ensemble;
+    AudioTestSink out[2];
+    AudioConnection c0{source, 0, ensemble, 0};
+    AudioConnection c1{ensemble, 0, out[0], 0};
+    AudioConnection c2{ensemble, 1, out[1], 0};
+
+    Chain(AudioTestSource::Generator g, float rate) : source(g)
+    {
+        ensemble.lfoRate(rate);
+    }
+
+    // Host microseconds per audio block, counted in blocks of 128 samples
+    // so the time covers the same audio at any block size
+    double run(int blocks)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int b = 0; b < blocksOf128(blocks); b++)
+            AudioStream::update_all();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / blocks;
+    }
+};
+
+void test_dc_is_exact()
+{
+    AudioMemory(16);
+    Chain<AudioEffectEnsemble> chain(dc, 20.0f);
+    chain.run(200);
+    // The buffer starts silent; once it has filled, every tap reads -12345
+    for (int ch = 0; ch < 2; ch++)
+        for (size_t i = 10 * 128; i < chain.out[ch].samples.size(); i++)
+            TEST_ASSERT_EQUAL_INT16(-12345, chain.out[ch].samples[i]);
+}
+
+// Error of out relative to reference, in dB below the reference signal
+static double errorDb(const std::vector<int16_t> &reference, const std::vector<int16_t> &out, int &maxDiff)
+{
+    double signal = 0, error = 0;
+    maxDiff = 0;
+    for (size_t i = 0; i < reference.size(); i++)
+    {
+        const int d = out[i] - reference[i];
+        signal += (double)reference[i] * reference[i];
+        error += (double)d * d;
+        maxDiff = std::max(maxDiff, abs(d));
+    }
+    return 10.0 * log10(signal / error);
+}
+
+void test_against_float_version()
+{
+    AudioMemory(16);
+    const float rates[] = {2.0f, 6.0f, 20.0f};
+    std::cout << "rate Hz | us/block float | us/block fixed | error L, R | max diff L, R" << std::endl;
+    for (float rate : rates)
+    {
+        std::vector<int16_t> reference[2];
+        double usLegacy;
+        {
+            Chain<LegacyEnsemble> legacy(strings, rate);
+            usLegacy = legacy.run(BLOCKS);
+            reference[0] = legacy.out[0].samples;
+            reference[1] = legacy.out[1].samples;
+        }
+        Chain<AudioEffectEnsemble> fixed(strings, rate);
+        const double usFixed = fixed.run(BLOCKS);
+        int maxL, maxR;
+        const double dbL = errorDb(reference[0], fixed.out[0].samples, maxL);
+        const double dbR = errorDb(reference[1], fixed.out[1].samples, maxR);
+        std::cout << std::setw(7) << rate << " | " << std::setw(14) << std::fixed << std::setprecision(2) << usLegacy
+                  << " | " << std::setw(14) << usFixed << " | " << -dbL << ", " << -dbR << " dB | "
+                  << maxL << ", " << maxR << std::endl;
+        // The remaining difference is mostly the old LFO's staircase, steps of
+        // up to 0.45 samples, which the per-block ramp smooths out
+        TEST_ASSERT_GREATER_THAN(40.0, dbL);
+        TEST_ASSERT_GREATER_THAN(40.0, dbR);
+    }
+}
+
+// Sound for a while, then silence, then sound again
+static int16_t gated(uint32_t t, void *context)
+{
+    const uint32_t block = t / 128;
+    return block < 40 || block >= 100 ? strings(t, context) : 0;
+}
+
+void test_sleeps_after_tail_and_wakes_exactly()
+{
+    AudioMemory(16);
+    // Reference keeps receiving zero blocks, so it never sleeps
+    std::vector<int16_t> reference[2];
+    {
+        Chain<AudioEffectEnsemble> chain(gated, 6.0f);
+        chain.run(160);
+        reference[0] = chain.out[0].samples;
+        reference[1] = chain.out[1].samples;
+    }
+    Chain<AudioEffectEnsemble> chain(strings, 6.0f);
+    chain.run(40);
+    chain.source.setSilent(true);
+    chain.run(60);
+    // The tail is one buffer long, then nothing is transmitted
+    const unsigned int tailBlocks = ENSEMBLE_BUFFER_SIZE / AUDIO_BLOCK_SAMPLES;
+    TEST_ASSERT_EQUAL_UINT(blocksOf128(60) - tailBlocks, chain.out[0].missing);
+    chain.source.setSilent(false);
+    chain.run(60);
+    TEST_ASSERT_EQUAL_UINT(blocksOf128(60) - tailBlocks, chain.out[0].missing);
+    for (int ch = 0; ch < 2; ch++)
+        TEST_ASSERT_EQUAL_INT16_ARRAY(reference[ch].data(), chain.out[ch].samples.data(), reference[ch].size());
+}
+
+void test_bypass_wakes_exactly()
+{
+    AudioMemory(16);
+    std::vector<int16_t> reference[2];
+    {
+        Chain<AudioEffectEnsemble> chain(strings, 6.0f);
+        chain.run(100);
+        reference[0] = chain.out[0].samples;
+        reference[1] = chain.out[1].samples;
+    }
+    Chain<AudioEffectEnsemble> chain(strings, 6.0f);
+    chain.ensemble.bypass(true);
+    chain.run(50);
+    TEST_ASSERT_EQUAL_UINT(blocksOf128(50), chain.out[0].missing);
+    chain.ensemble.bypass(false);
+    chain.run(50);
+    TEST_ASSERT_EQUAL_UINT(blocksOf128(50), chain.out[0].missing);
+    // Once switched back in, the output is what it would have been all along
+    for (int ch = 0; ch < 2; ch++)
+        TEST_ASSERT_EQUAL_INT16_ARRAY(reference[ch].data() + 50 * 128,
+                                      chain.out[ch].samples.data() + 50 * 128, 50 * 128);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_dc_is_exact);
+    RUN_TEST(test_against_float_version);
+    RUN_TEST(test_sleeps_after_tail_and_wakes_exactly);
+    RUN_TEST(test_bypass_wakes_exactly);
+    UNITY_END();
+}
@@ -0,0 +1,227 @@
+//
+// AudioEffectEnvelopeTS generator mode against the effect fed with DC 1.0,
+// as the filter envelope was driven before, getLevel() tracking, and
+// shared, table driven coefficients against per-envelope ones, and host
+// timing of the block paths per envelope type.
+//
+#include <unity.h>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <math.h>
+#include "AudioTestNodes.h"
+#include "../../TSynth/block_tags.cpp"
+#include "../../TSynth/effect_envelope.cpp"
+
+void setUp() {}
+void tearDown() {}
+
+// AudioSynthWaveformDcTS at amplitude(1.0)
+static int16_t dc(uint32_t t, void *context)
+{
+    return 0x7FFF;
+}
+
+static void configure(AudioEffectEnvelopeTS &env, int8_t type)
+{
+    // The exponential state isn't set by the constructor, on the Teensy
+    // the envelopes are zero initialised globals
+    env.close();
+    env.setEnvType(type);
+    env.attack(20.0f);
+    env.decay(50.0f);
+    env.sustain(0.6f);
+    env.release(80.0f);
+}
+
+// Note on, held into sustain, released to silence, then retriggered
+// during the release to go through the forced release state
+static void compare(int8_t type)
+{
+    AudioMemory(16);
+    AudioTestSource source(dc);
+    AudioEffectEnvelopeTS effect, generator;
+    AudioTestSink effectOut, generatorOut;
+    AudioConnection c1(source, 0, effect, 0);
+    AudioConnection c2(effect, 0, effectOut, 0);
+    AudioConnection c3(generator, 0, generatorOut, 0);
+    configure(effect, type);
+    configure(generator, type);
+    generator.generator(true);
+
+    const int steps[][2] = {{1, 60}, {0, 20}, {1, 10}, {0, 200}};
+    for (auto &step : steps)
+    {
+        if (step[0])
+        {
+            effect.noteOn();
+            generator.noteOn();
+        }
+        else
+        {
+            effect.noteOff();
+            generator.noteOff();
+        }
+        for (int b = 0; b < blocksOf128(step[1]); b++)
+        {
+            AudioStream::update_all();
+            TEST_ASSERT_EQUAL_FLOAT(effect.getLevel(), generator.getLevel());
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(effectOut.samples.size(), generatorOut.samples.size());
+    TEST_ASSERT_EQUAL_INT16_ARRAY(effectOut.samples.data(), generatorOut.samples.data(), effectOut.samples.size());
+    // Released to silence and idle
+    TEST_ASSERT_FALSE(generator.isActive());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, generator.getLevel());
+}
+
+void test_linear_generator_matches_effect()
+{
+    compare(-128);
+}
+
+void test_exponential_generator_matches_effect()
+{
+    compare(-8);
+    compare(0);
+    compare(5);
+}
+
+void test_level_follows_envelope()
+{
+    AudioMemory(16);
+    AudioEffectEnvelopeTS env;
+    AudioTestSink out;
+    AudioConnection c(env, 0, out, 0);
+    configure(env, -128);
+    env.generator(true);
+    env.noteOn();
+    // Well into sustain
+    for (int b = 0; b < blocksOf128(60); b++)
+        AudioStream::update_all();
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 0.6, env.getLevel());
+    TEST_ASSERT_INT_WITHIN(330, 0.6 * 32767, out.samples.back());
+}
+
+// A few panel time steps, as ENVTIMES would be
+static const uint16_t TIMES[] = {1, 20, 89, 333, 1031, 4012, 11700};
+
+static void run(AudioEffectEnvelopeTS *envelopes[], int n, int blocks)
+{
+    for (int i = 0; i < n; i++)
+        envelopes[i]->noteOn();
+    for (int i = 0; i < blocks; i++)
+        AudioStream::update_all();
+    for (int i = 0; i < n; i++)
+        envelopes[i]->noteOff();
+    for (int i = 0; i < blocks; i++)
+        AudioStream::update_all();
+}
+
+void test_shared_table_coefficients_are_exact()
+{
+    AudioMemory(16);
+    AudioEnvelopeCoefsTS::buildTables(TIMES, sizeof(TIMES) / sizeof(TIMES[0]));
+    // -8 and 4 have attack tables, -3 and 8 are computed
+    const int8_t tabled[] = {-8, 4};
+    AudioEnvelopeCoefsTS::buildAttackTables(tabled, 2);
+    const int8_t types[] = {-128, -8, -3, 0, 4, 8};
+    // Table times, then times that fall back to computing
+    const float times[][3] = {{20, 333, 89}, {1031, 1, 4012}, {21, 300, 95.5f}};
+    for (int8_t type : types)
+    {
+        for (auto &t : times)
+        {
+            AudioEnvelopeCoefsTS shared;
+            AudioEffectEnvelopeTS own, voice[2];
+            AudioTestSink ownOut, voiceOut[2];
+            AudioConnection c0(own, 0, ownOut, 0);
+            AudioConnection c1(voice[0], 0, voiceOut[0], 0);
+            AudioConnection c2(voice[1], 0, voiceOut[1], 0);
+            own.close();
+            own.generator(true);
+            own.setEnvType(type);
+            own.attack(t[0]);
+            own.decay(t[1]);
+            own.release(t[2]);
+            own.sustain(0.5f);
+            for (auto &v : voice)
+            {
+                v.close();
+                v.generator(true);
+                v.useCoefs(&shared);
+                v.sustain(0.5f);
+            }
+            shared.setEnvType(type);
+            shared.attack(t[0]);
+            shared.decay(t[1]);
+            shared.release(t[2]);
+            AudioEffectEnvelopeTS *all[] = {&own, &voice[0], &voice[1]};
+            run(all, 3, blocksOf128(30));
+            TEST_ASSERT_EQUAL_INT16_ARRAY(ownOut.samples.data(), voiceOut[0].samples.data(), ownOut.samples.size());
+            TEST_ASSERT_EQUAL_INT16_ARRAY(ownOut.samples.data(), voiceOut[1].samples.data(), ownOut.samples.size());
+        }
+    }
+}
+
+// Host microseconds per block for all the envelopes, generator mode with
+// nothing connected so only the envelope code is timed
+static double timeBlocks(int blocks)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int b = 0; b < blocks; b++)
+        AudioStream::update_all();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / blocks;
+}
+
+void test_block_path_timing()
+{
+    const int VOICES = 12;
+    AudioMemory(16);
+    std::cout << "env type | us/block attack+decay | us/block sustain (12 voices)" << std::endl;
+    for (int t = -9; t <= 8; t++)
+    {
+        const int8_t type = t < -8 ? -128 : t;
+        AudioEnvelopeCoefsTS coefs;
+        AudioEffectEnvelopeTS env[VOICES];
+        AudioTestSink sink;
+        AudioConnection *connections[VOICES];
+        coefs.setEnvType(type);
+        coefs.attack(150.0f);
+        coefs.decay(50.0f);
+        for (int i = 0; i < VOICES; i++)
+        {
+            env[i].close();
+            env[i].generator(true);
+            env[i].useCoefs(&coefs);
+            env[i].sustain(0.5f);
+            // Connected only to make the envelope active
+            connections[i] = new AudioConnection(env[i], 0, sink, 0);
+            connections[i]->disconnect();
+            env[i].noteOn();
+        }
+        const double moving = timeBlocks(blocksOf128(30));
+        // Let the decay settle, then time the sustain
+        for (int b = 0; b < blocksOf128(400); b++)
+            AudioStream::update_all();
+        const double sustain = timeBlocks(100);
+        std::cout << std::setw(8) << (int)type << " | " << std::setw(21) << std::fixed << std::setprecision(3) << moving
+                  << " | " << sustain << std::endl;
+        TEST_ASSERT_TRUE(env[0].isSustain());
+        TEST_ASSERT_EQUAL_FLOAT(0.5f, env[0].getLevel());
+        for (int i = 0; i < VOICES; i++)
+            delete connections[i];
+    }
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_linear_generator_matches_effect);
+    RUN_TEST(test_exponential_generator_matches_effect);
+    RUN_TEST(test_level_follows_envelope);
+    RUN_TEST(test_shared_table_coefficients_are_exact);
+    RUN_TEST(test_block_path_timing);
+    UNITY_END();
+}
@@ -0,0 +1,171 @@
+//
+// Control-rate coefficient interpolation in AudioFilterStateVariableTS:
+// deviation from the per-sample path and host timing for a full 12 voice
+// filter bank.
+//
+#include <unity.h>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <math.h>
+#include "AudioTestNodes.h"
+#include "../../TSynth/block_tags.cpp"
+#include "../../TSynth/filter_variable.cpp"
+
+static const int VOICES = 12;
+static const int BLOCKS = 400;
+
+void setUp() {}
+void tearDown() {}
+
+// Sawtooth a few semitones apart per voice
+static int16_t saw(uint32_t t, void *context)
+{
+    const float freq = 110.0f * powf(2.0f, (intptr_t)context / 12.0f);
+    const float phase = fmodf(t * freq / AUDIO_SAMPLE_RATE_EXACT, 1.0f);
+    return (int16_t)((phase * 2.0f - 1.0f) * 16000.0f);
+}
+
+// Filter envelope (5ms attack, retriggered every 200ms) plus a 4Hz LFO, as
+// filterModMixer_ would produce it
+static int16_t sweep(uint32_t t, void *context)
+{
+    const float seconds = t / AUDIO_SAMPLE_RATE_EXACT;
+    const float since = fmodf(seconds, 0.2f);
+    const float env = since < 0.005f ? since / 0.005f : expf(-(since - 0.005f) * 15.0f);
+    const float lfo = sinf(2.0f * (float)M_PI * 4.0f * seconds + (intptr_t)context);
+    return (int16_t)((0.6f * env + 0.3f * lfo - 0.2f) * 32767.0f);
+}
+
+static int16_t held(uint32_t t, void *context)
+{
+    return 12000;
+}
+
+struct FilterBank
+{
+    AudioTestSource *audio[VOICES];
+    AudioTestSource *control[VOICES];
+    AudioFilterStateVariableTS filter[VOICES];
+    AudioTestSink out[VOICES];
+    AudioConnection *connections[VOICES * 3];
+
+    FilterBank(uint8_t controlRate, AudioTestSource::Generator ctl)
+    {
+        for (int i = 0; i < VOICES; i++)
+        {
+            audio[i] = new AudioTestSource(saw, (void *)(intptr_t)i);
+            control[i] = new AudioTestSource(ctl, (void *)(intptr_t)i);
+            filter[i].frequency(400.0f);
+            filter[i].resonance(4.0f);
+            filter[i].octaveControl(7.0f);
+            filter[i].controlRate(controlRate);
+            connections[i * 3] = new AudioConnection(*audio[i], 0, filter[i], 0);
+            connections[i * 3 + 1] = new AudioConnection(*control[i], 0, filter[i], 1);
+            connections[i * 3 + 2] = new AudioConnection(filter[i], 0, out[i], 0);
+        }
+    }
+
+    ~FilterBank()
+    {
+        for (int i = 0; i < VOICES; i++)
+        {
+            delete connections[i * 3];
+            delete connections[i * 3 + 1];
+            delete connections[i * 3 + 2];
+            delete audio[i];
+            delete control[i];
+        }
+    }
+
+    // Host microseconds per audio block for the whole bank
+    double run()
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int b = 0; b < BLOCKS; b++)
+            AudioStream::update_all();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / BLOCKS;
+    }
+};
+
+// Error of out relative to reference, in dB below the reference signal.
+// The first blocks are skipped: the interpolated path ramps in from the
+// unmodulated corner frequency while the per-sample path jumps.
+static double errorDb(const std::vector<int16_t> &reference, const std::vector<int16_t> &out)
+{
+    double signal = 0, error = 0;
+    for (size_t i = 10 * AUDIO_BLOCK_SAMPLES; i < reference.size(); i++)
+    {
+        const double d = (double)out[i] - reference[i];
+        signal += (double)reference[i] * reference[i];
+        error += d * d;
+    }
+    if (error == 0)
+        return INFINITY;
+    return 10.0 * log10(signal / error);
+}
+
+void test_constant_control_is_exact()
+{
+    AudioMemory(64);
+    std::vector<int16_t> reference;
+    {
+        FilterBank bank(1, held);
+        bank.run();
+        reference = bank.out[0].samples;
+    }
+    FilterBank bank(16, held);
+    bank.run();
+    TEST_ASSERT_EQUAL_INT(reference.size(), bank.out[0].samples.size());
+    TEST_ASSERT_EQUAL_INT16_ARRAY(reference.data(), bank.out[0].samples.data(), reference.size());
+}
+
+void test_control_rate_error_and_timing()
+{
+    AudioMemory(64);
+    const uint8_t rates[] = {1, 4, 8, 16, 32};
+    std::vector<int16_t> reference[VOICES];
+    std::cout << "control rate | host us/block (12 voices) | error vs per-sample" << std::endl;
+    for (uint8_t rate : rates)
+    {
+        FilterBank bank(rate, sweep);
+        const double us = bank.run();
+        double worst = INFINITY;
+        for (int v = 0; v < VOICES; v++)
+        {
+            if (rate == 1)
+                reference[v] = bank.out[v].samples;
+            else
+                worst = fmin(worst, errorDb(reference[v], bank.out[v].samples));
+        }
+        std::cout << std::setw(12) << (int)rate << " | " << std::setw(25) << std::fixed << std::setprecision(2) << us
+                  << " | " << (rate == 1 ? std::string("reference") : std::to_string(-worst) + " dB") << std::endl;
+        // Both quality settings must stay closer to the reference than a
+        // 5 cent shift of the whole cutoff trajectory (about -36dB)
+        if (rate == 8 || rate == 16)
+            TEST_ASSERT_GREATER_THAN(40.0, worst);
+    }
+
+    // For scale: the same error measure for a constant cutoff offset
+    const float cents[] = {1.0f, 5.0f};
+    for (float c : cents)
+    {
+        FilterBank bank(1, sweep);
+        for (int v = 0; v < VOICES; v++)
+            bank.filter[v].frequency(400.0f * powf(2.0f, c / 1200.0f));
+        bank.run();
+        double worst = INFINITY;
+        for (int v = 0; v < VOICES; v++)
+            worst = fmin(worst, errorDb(reference[v], bank.out[v].samples));
+        std::cout << "cutoff +" << c << " cents, per-sample | error " << -worst << " dB" << std::endl;
+    }
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_constant_control_is_exact);
+    RUN_TEST(test_control_rate_error_and_timing);
+    UNITY_END();
+}
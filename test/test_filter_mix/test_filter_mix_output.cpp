@@ -0,0 +1,105 @@
+//
+// AudioFilterStateVariableTS::mixOutput(): one mixed block against the three
+// separate outputs, and the block usage of each mode.
+//
+#include <unity.h>
+#include <iostream>
+#include <math.h>
+#include "AudioTestNodes.h"
+#include "../../TSynth/block_tags.cpp"
+#include "../../TSynth/filter_variable.cpp"
+
+static const int BLOCKS = 50;
+
+void setUp() {}
+void tearDown() {}
+
+static int16_t saw(uint32_t t, void *context)
+{
+    const float phase = fmodf(t * 220.0f / AUDIO_SAMPLE_RATE_EXACT, 1.0f);
+    return (int16_t)((phase * 2.0f - 1.0f) * 16000.0f);
+}
+
+static int16_t sweep(uint32_t t, void *context)
+{
+    return (int16_t)(0.5f * 32767.0f * sinf(2.0f * (float)M_PI * 3.0f * t / AUDIO_SAMPLE_RATE_EXACT));
+}
+
+struct Voice
+{
+    AudioTestSource audio{saw};
+    AudioTestSource control{sweep};
+    AudioFilterStateVariableTS filter;
+    AudioTestSink out[3];
+    AudioConnection c0{audio, 0, filter, 0};
+    AudioConnection c1{control, 0, filter, 1};
+    AudioConnection c2{filter, 0, out[0], 0};
+    AudioConnection c3{filter, 1, out[1], 0};
+    AudioConnection c4{filter, 2, out[2], 0};
+
+    Voice()
+    {
+        filter.frequency(600.0f);
+        filter.resonance(3.0f);
+        filter.octaveControl(3.0f);
+    }
+};
+
+static void run()
+{
+    for (int b = 0; b < BLOCKS; b++)
+        AudioStream::update_all();
+}
+
+void test_single_mode_is_exact()
+{
+    AudioMemory(16);
+    Voice separate, mixed;
+    mixed.filter.mixOutput(0.0f, 1.0f, 0.0f);
+    run();
+    TEST_ASSERT_EQUAL_INT16_ARRAY(separate.out[1].samples.data(), mixed.out[0].samples.data(), BLOCKS * AUDIO_BLOCK_SAMPLES);
+    // Nothing on the other outputs
+    TEST_ASSERT_EQUAL_INT(BLOCKS, mixed.out[1].missing);
+    TEST_ASSERT_EQUAL_INT(BLOCKS, mixed.out[2].missing);
+}
+
+void test_blend_matches_mixer()
+{
+    AudioMemory(16);
+    Voice separate, mixed;
+    mixed.filter.mixOutput(0.3f, 0.0f, 0.7f);
+    run();
+    int worst = 0;
+    for (size_t i = 0; i < separate.out[0].samples.size(); i++)
+    {
+        const float expected = 0.3f * separate.out[0].samples[i] + 0.7f * separate.out[2].samples[i];
+        worst = fmax(worst, fabsf(expected - mixed.out[0].samples[i]));
+    }
+    std::cout << "LP 30 - 70 HP: worst difference " << worst << " LSB" << std::endl;
+    TEST_ASSERT_LESS_OR_EQUAL(2, worst);
+}
+
+void test_block_usage()
+{
+    unsigned int peak[2];
+    for (int mode = 0; mode < 2; mode++)
+    {
+        AudioMemory(16);
+        Voice voice;
+        if (mode)
+            voice.filter.mixOutput(1.0f, 0.0f, 0.0f);
+        run();
+        peak[mode] = AudioMemoryUsageMax();
+    }
+    std::cout << "peak blocks per voice: separate " << peak[0] << ", mixed " << peak[1] << std::endl;
+    TEST_ASSERT_EQUAL_INT(peak[0] - 2, peak[1]);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_single_mode_is_exact);
+    RUN_TEST(test_blend_matches_mixer);
+    RUN_TEST(test_block_usage);
+    UNITY_END();
+}
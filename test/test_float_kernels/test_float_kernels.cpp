@@ -0,0 +1,448 @@
+//
+// The float32 kernel variants in float_kernels.h against the fixed point
+// ones: state variable filter, envelope, mixer bus and ensemble, each pair
+// fed the same input and within a couple of LSB of each other. Where there
+// is a double precision model to measure against, the error of each, then
+// the host time per block of both. The table printed at the end is the
+// host side of the one in float_kernels.h.
+//
+#include <unity.h>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <math.h>
+#include "AudioTestNodes.h"
+#include "../../TSynth/block_tags.cpp"
+#include "../../TSynth/filter_variable.cpp"
+#include "../../TSynth/effect_envelope.cpp"
+#include "../../TSynth/mixer_bus.cpp"
+#include "../../TSynth/effect_ensemble.cpp"
+
+static const int VOICES = 12;
+static const int BLOCKS = 100;
+
+void setUp() {}
+void tearDown() {}
+
+// One period of a waveform, read round and round, so the sources cost
+// next to nothing in the timings
+struct Wave
+{
+    std::vector<int16_t> table;
+    Wave(int period, float (*shape)(float), float amplitude) : table(period)
+    {
+        for (int i = 0; i < period; i++)
+            table[i] = (int16_t)(amplitude * shape((float)i / period));
+    }
+};
+
+static int16_t wave(uint32_t t, void *context)
+{
+    const Wave *w = (const Wave *)context;
+    return w->table[t % w->table.size()];
+}
+
+static float saw(float p) { return 2.0f * p - 1.0f; }
+static float sine(float p) { return sinf(2.0f * (float)M_PI * p); }
+static float strings(float p) { return 0.5f * sine(p) + 0.3f * sine(3 * p) + 0.2f * sine(7 * p); }
+
+static const Wave SAW(200, saw, 16000.0f);
+static const Wave STRINGS(400, strings, 20000.0f);
+// a filter sweep over a third of a second
+static const Wave SWEEP(15000, sine, 16000.0f);
+
+// What the table reports for each kernel
+struct Row
+{
+    const char *kernel;
+    int maxDiff;
+    double fixedDb, floatDb;  // error against the double model, NAN if none
+    double fixedUs, floatUs;
+};
+static Row rows[] = {{"state variable", 0, NAN, NAN, 0, 0},
+                     {"envelope", 0, NAN, NAN, 0, 0},
+                     {"mixer bus", 0, NAN, NAN, 0, 0},
+                     {"ensemble", 0, NAN, NAN, 0, 0}};
+enum { SVF, ENVELOPE, MIXER_BUS, ENSEMBLE };
+
+static void run(int blocks)
+{
+    for (int b = 0; b < blocksOf128(blocks); b++)
+        AudioStream::update_all();
+}
+
+static int maxDiff(const std::vector<int16_t> &a, const std::vector<int16_t> &b)
+{
+    int worst = a.size() == b.size() ? 0 : 65536;
+    for (size_t i = 0; i < std::min(a.size(), b.size()); i++)
+        worst = std::max(worst, abs(a[i] - b[i]));
+    return worst;
+}
+
+// Error energy relative to the reference's, in dB, from sample first on
+static double errorDb(const std::vector<int16_t> &out, const std::vector<double> &reference, size_t first = 0)
+{
+    double signal = 0, error = 0;
+    for (size_t i = first; i < out.size(); i++)
+    {
+        signal += reference[i] * reference[i];
+        error += (out[i] - reference[i]) * (out[i] - reference[i]);
+    }
+    return 10.0 * log10(error / signal);
+}
+
+// Both variants of a kernel on the same source, out[0] fixed, out[1] float
+template <class Kernel>
+struct Pair
+{
+    AudioTestSource audio{wave, (void *)&SAW};
+    AudioTestSource control{wave, (void *)&SWEEP};
+    Kernel kernel[2];
+    AudioTestSink out[2];
+    std::vector<std::unique_ptr<AudioConnection>> connections;
+
+    Pair(const Wave &input = SAW, bool controlled = false) : audio(wave, (void *)&input)
+    {
+        for (int k = 0; k < 2; k++)
+        {
+            connections.emplace_back(new AudioConnection(audio, 0, kernel[k], 0));
+            if (controlled)
+                connections.emplace_back(new AudioConnection(control, 0, kernel[k], 1));
+            connections.emplace_back(new AudioConnection(kernel[k], 0, out[k], 0));
+            kernel[k].useFloat(k == 1);
+        }
+    }
+};
+
+// The filter in double, on the coefficients the fixed point one gets from
+// frequency() and resonance()
+static std::vector<double> svfModel(const std::vector<int16_t> &in, float freq, float q)
+{
+    const int32_t fmult = sinf(freq * (3.141592654 / (AUDIO_SAMPLE_RATE_EXACT * 2.0))) * 2147483647.0;
+    const int32_t damp = (1.0 / q) * 1073741824.0;
+    const double f = fmult / 1073741824.0, d = damp / 1073741824.0;
+    double lowpass = 0, bandpass = 0, highpass, inputprev = 0;
+    std::vector<double> out;
+    for (int16_t x : in)
+    {
+        lowpass += f * bandpass;
+        highpass = (x + inputprev) * 0.5 - lowpass - d * bandpass;
+        inputprev = x;
+        bandpass += f * highpass;
+        const double lowpasstmp = lowpass;
+        lowpass += f * bandpass;
+        highpass = x - lowpass - d * bandpass;
+        bandpass += f * highpass;
+        out.push_back(std::max(-32768.0, std::min(32767.0, (lowpass + lowpasstmp) * 0.5)));
+    }
+    return out;
+}
+
+static std::vector<int16_t> input(const Wave &w, size_t n)
+{
+    std::vector<int16_t> in(n);
+    for (size_t i = 0; i < n; i++)
+        in[i] = wave(i, (void *)&w);
+    return in;
+}
+
+void test_svf_matches_fixed()
+{
+    AudioMemory(32);
+    // fixed corners: low, where the coefficients are smallest, and high
+    // with resonance
+    const float corners[][2] = {{60.0f, 0.707f}, {4000.0f, 8.0f}};
+    for (auto &c : corners)
+    {
+        Pair<AudioFilterStateVariableTS> pair;
+        for (auto &k : pair.kernel)
+        {
+            k.frequency(c[0]);
+            k.resonance(c[1]);
+        }
+        run(BLOCKS);
+        const int diff = maxDiff(pair.out[0].samples, pair.out[1].samples);
+        const std::vector<double> model = svfModel(input(SAW, pair.out[0].samples.size()), c[0], c[1]);
+        const double fixedDb = errorDb(pair.out[0].samples, model), floatDb = errorDb(pair.out[1].samples, model);
+        std::cout << "svf " << c[0] << "Hz q " << c[1] << ": max difference " << diff << ", error against double: fixed "
+                  << fixedDb << " dB, float " << floatDb << " dB" << std::endl;
+        TEST_ASSERT_LESS_OR_EQUAL(4, diff);
+        rows[SVF].maxDiff = std::max(rows[SVF].maxDiff, diff);
+        if (c[0] < 100.0f)
+        {
+            rows[SVF].fixedDb = fixedDb;
+            rows[SVF].floatDb = floatDb;
+        }
+    }
+    // swept by the control input, per sample, interpolated, and mixed
+    for (int mode = 0; mode < 3; mode++)
+    {
+        Pair<AudioFilterStateVariableTS> pair(SAW, true);
+        for (auto &k : pair.kernel)
+        {
+            k.frequency(600.0f);
+            k.resonance(3.0f);
+            k.octaveControl(3.0f);
+            k.controlRate(mode ? 8 : 1);
+            if (mode == 2)
+                k.mixOutput(0.5f, 0.3f, 0.2f);
+        }
+        run(BLOCKS);
+        const int diff = maxDiff(pair.out[0].samples, pair.out[1].samples);
+        std::cout << "svf swept, control rate " << (mode ? 8 : 1) << (mode == 2 ? " mixed" : "")
+                  << ": max difference " << diff << std::endl;
+        TEST_ASSERT_LESS_OR_EQUAL(4, diff);
+        rows[SVF].maxDiff = std::max(rows[SVF].maxDiff, diff);
+    }
+}
+
+void test_envelope_matches_fixed()
+{
+    AudioMemory(16);
+    const int8_t types[] = {-128, -4, 0, 5};
+    for (int8_t type : types)
+    {
+        for (int generator = 0; generator < 2; generator++)
+        {
+            Pair<AudioEffectEnvelopeTS> pair;
+            for (auto &k : pair.kernel)
+            {
+                // zero initialised globals on the Teensy
+                k.close();
+                k.generator(generator);
+                k.setEnvType(type);
+                k.attack(20.0f);
+                k.decay(50.0f);
+                k.sustain(0.6f);
+                k.release(80.0f);
+                k.noteOn();
+            }
+            run(60);
+            // held at the sustain level, as the model has it
+            const size_t held = pair.out[0].samples.size() - 20 * 128;
+            for (auto &k : pair.kernel)
+                k.noteOff();
+            run(60);
+            const int diff = maxDiff(pair.out[0].samples, pair.out[1].samples);
+            std::cout << "envelope type " << (int)type << (generator ? " generator" : "") << ": max difference " << diff << std::endl;
+            TEST_ASSERT_LESS_OR_EQUAL(4, diff);
+            rows[ENVELOPE].maxDiff = std::max(rows[ENVELOPE].maxDiff, diff);
+            if (type == -128 && !generator)
+            {
+                const std::vector<int16_t> in = input(SAW, pair.out[0].samples.size());
+                std::vector<double> model(in.size());
+                for (size_t i = 0; i < in.size(); i++)
+                    model[i] = in[i] * 0.6;
+                std::vector<int16_t> fixed(pair.out[0].samples.begin(), pair.out[0].samples.begin() + blocksOf128(60) * AUDIO_BLOCK_SAMPLES);
+                std::vector<int16_t> flt(pair.out[1].samples.begin(), pair.out[1].samples.begin() + fixed.size());
+                rows[ENVELOPE].fixedDb = errorDb(fixed, model, held);
+                rows[ENVELOPE].floatDb = errorDb(flt, model, held);
+            }
+        }
+    }
+    std::cout << "envelope: max difference " << rows[ENVELOPE].maxDiff << ", error in sustain: fixed "
+              << rows[ENVELOPE].fixedDb << " dB, float " << rows[ENVELOPE].floatDb << " dB" << std::endl;
+}
+
+static float velocity(int v)
+{
+    return 0.4f + 0.05f * v;
+}
+
+// Twelve voices, made before the buses so they update first
+struct Sources
+{
+    std::vector<std::unique_ptr<Wave>> waves;
+    std::vector<std::unique_ptr<AudioTestSource>> sources;
+
+    Sources()
+    {
+        for (int v = 0; v < VOICES; v++)
+        {
+            waves.emplace_back(new Wave(37 + 11 * v, sine, 20000.0f));
+            sources.emplace_back(new AudioTestSource(wave, waves[v].get()));
+        }
+    }
+};
+
+// On both variants of the bus, at velocity and mixer level
+struct Buses : Sources
+{
+    AudioMixerBusTS<VOICES> bus[2];
+    AudioTestSink out[2];
+    std::vector<std::unique_ptr<AudioConnection>> connections;
+
+    Buses()
+    {
+        for (int k = 0; k < 2; k++)
+        {
+            for (int v = 0; v < VOICES; v++)
+            {
+                connections.emplace_back(new AudioConnection(*sources[v], 0, bus[k], v));
+                bus[k].gain(v, velocity(v));
+            }
+            bus[k].gain(0.28f);
+            bus[k].useFloat(k == 1);
+            connections.emplace_back(new AudioConnection(bus[k], 0, out[k], 0));
+        }
+    }
+};
+
+void test_mixer_bus_matches_fixed()
+{
+    AudioMemory(40);
+    Buses buses;
+    run(50);
+    const int diff = maxDiff(buses.out[0].samples, buses.out[1].samples);
+    std::vector<double> model(buses.out[0].samples.size());
+    for (size_t i = 0; i < model.size(); i++)
+    {
+        double sum = 0;
+        for (int v = 0; v < VOICES; v++)
+            sum += wave(i, buses.waves[v].get()) * (double)velocity(v);
+        model[i] = std::max(-32768.0, std::min(32767.0, sum * 0.28));
+    }
+    rows[MIXER_BUS].maxDiff = diff;
+    rows[MIXER_BUS].fixedDb = errorDb(buses.out[0].samples, model);
+    rows[MIXER_BUS].floatDb = errorDb(buses.out[1].samples, model);
+    std::cout << "mixer bus: max difference " << diff << ", error against double: fixed " << rows[MIXER_BUS].fixedDb
+              << " dB, float " << rows[MIXER_BUS].floatDb << " dB" << std::endl;
+    TEST_ASSERT_LESS_OR_EQUAL(4, diff);
+}
+
+void test_ensemble_matches_fixed()
+{
+    AudioMemory(16);
+    Pair<AudioEffectEnsemble> pair(STRINGS);
+    // the second output too
+    AudioTestSink outB[2];
+    AudioConnection b0(pair.kernel[0], 1, outB[0], 0);
+    AudioConnection b1(pair.kernel[1], 1, outB[1], 0);
+    run(BLOCKS);
+    const int diff = std::max(maxDiff(pair.out[0].samples, pair.out[1].samples), maxDiff(outB[0].samples, outB[1].samples));
+    rows[ENSEMBLE].maxDiff = diff;
+    std::cout << "ensemble: max difference " << diff << std::endl;
+    TEST_ASSERT_LESS_OR_EQUAL(4, diff);
+}
+
+// Host microseconds per block for the objects set up by make, fixed then
+// float, the best of a few runs each
+template <class Make>
+static void timeBoth(Row &row, Make make)
+{
+    double best[2] = {1e9, 1e9};
+    for (int rep = 0; rep < 5; rep++)
+    {
+        for (int f = 0; f < 2; f++)
+        {
+            auto objects = make(f == 1);
+            run(10);
+            auto start = std::chrono::steady_clock::now();
+            for (int b = 0; b < blocksOf128(BLOCKS); b++)
+                AudioStream::update_all();
+            auto end = std::chrono::steady_clock::now();
+            best[f] = std::min(best[f], std::chrono::duration<double, std::micro>(end - start).count() / blocksOf128(BLOCKS));
+        }
+    }
+    row.fixedUs = best[0];
+    row.floatUs = best[1];
+}
+
+// A voice's worth of each kernel, VOICES of them, fed from one source
+struct Voices
+{
+    AudioTestSource audio{wave, (void *)&SAW};
+    AudioTestSource control{wave, (void *)&SWEEP};
+    std::vector<std::unique_ptr<AudioConnection>> connections;
+};
+
+struct Filters : Voices
+{
+    AudioFilterStateVariableTS filter[VOICES];
+    Filters(bool f)
+    {
+        for (auto &k : filter)
+        {
+            connections.emplace_back(new AudioConnection(audio, 0, k, 0));
+            connections.emplace_back(new AudioConnection(control, 0, k, 1));
+            k.octaveControl(3.0f);
+            k.mixOutput(1.0f, 0.0f, 0.0f);
+            k.useFloat(f);
+        }
+    }
+};
+
+struct Envelopes : Voices
+{
+    AudioEffectEnvelopeTS envelope[VOICES];
+    Envelopes(bool f)
+    {
+        for (auto &k : envelope)
+        {
+            connections.emplace_back(new AudioConnection(audio, 0, k, 0));
+            k.close();
+            k.setEnvType(-4);
+            k.attack(2000.0f);
+            k.useFloat(f);
+            k.noteOn();
+        }
+    }
+};
+
+struct Bus : Voices
+{
+    AudioMixerBusTS<VOICES> bus;
+    Bus(bool f)
+    {
+        for (int v = 0; v < VOICES; v++)
+        {
+            connections.emplace_back(new AudioConnection(audio, 0, bus, v));
+            bus.gain(v, velocity(v));
+        }
+        bus.useFloat(f);
+    }
+};
+
+struct Ensemble : Voices
+{
+    AudioEffectEnsemble ensemble;
+    Ensemble(bool f)
+    {
+        connections.emplace_back(new AudioConnection(audio, 0, ensemble, 0));
+        ensemble.useFloat(f);
+    }
+};
+
+void test_benchmark_table()
+{
+    AudioMemory(64);
+    timeBoth(rows[SVF], [](bool f) { return std::unique_ptr<Filters>(new Filters(f)); });
+    timeBoth(rows[ENVELOPE], [](bool f) { return std::unique_ptr<Envelopes>(new Envelopes(f)); });
+    timeBoth(rows[MIXER_BUS], [](bool f) { return std::unique_ptr<Bus>(new Bus(f)); });
+    timeBoth(rows[ENSEMBLE], [](bool f) { return std::unique_ptr<Ensemble>(new Ensemble(f)); });
+    std::cout << AUDIO_BLOCK_SAMPLES << " sample blocks, host us/block, 12 voices (1 ensemble) from one source"
+              << std::endl;
+    std::cout << "kernel         | fixed us | float us | max diff | fixed dB | float dB" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    for (const Row &r : rows)
+    {
+        std::cout << std::left << std::setw(14) << r.kernel << std::right << " | " << std::setw(8) << r.fixedUs
+                  << " | " << std::setw(8) << r.floatUs << " | " << std::setw(8) << r.maxDiff << " | ";
+        if (isnan(r.fixedDb))
+            std::cout << "       - |        -" << std::endl;
+        else
+            std::cout << std::setw(8) << r.fixedDb << " | " << std::setw(8) << r.floatDb << std::endl;
+    }
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_svf_matches_fixed);
+    RUN_TEST(test_envelope_matches_fixed);
+    RUN_TEST(test_mixer_bus_matches_fixed);
+    RUN_TEST(test_ensemble_matches_fixed);
+    RUN_TEST(test_benchmark_table);
+    UNITY_END();
+}
@@ -0,0 +1,222 @@
+//
+// The compile time graph in AudioGraph.h and the TSynth graph described in
+// SynthGraph.h: sorting and feedback edges on small graphs, then the
+// schedule and peak block count for each configuration, checked against
+// the same graph of pass through objects run by the native AudioStream.
+//
+#include <unity.h>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <vector>
+#include "AudioStream.h"
+#include "../../TSynth/SynthGraph.h"
+
+using AudioGraph::AUDIO;
+using AudioGraph::CONTROL;
+using AudioGraph::FEEDBACK;
+
+void setUp() {}
+void tearDown() {}
+
+// Inputs on the widest node, a timbre's voice mixer
+static const int INPUTS = SynthGraph::VOICES_PER_GROUP;
+
+// Receives every input and sends a block on each output it feeds, taking
+// the first from its input as the node says it does, and keeps the blocks
+// it holds like an output's queue
+class GraphNode : public AudioStream
+{
+public:
+    GraphNode(uint8_t o, const AudioGraph::Node &node)
+        : AudioStream(INPUTS, inputQueueArray), outputs(o), inPlace(node.inPlace), held(node.held) {}
+    ~GraphNode()
+    {
+        for (audio_block_t *b : queue)
+            release(b);
+    }
+    virtual void update(void)
+    {
+        audio_block_t *in[INPUTS];
+        uint8_t from = inPlace;
+        for (int i = 0; i < INPUTS; i++)
+        {
+            in[i] = receiveReadOnly(i);
+            if (in[i] && from == AudioGraph::FIRST_INPUT)
+                from = i;
+        }
+        for (int i = 0; i < INPUTS && from == AudioGraph::ALL_INPUTS; i++)
+            if (in[i])
+                release(in[i]), in[i] = NULL;
+        for (uint8_t o = 0; o < outputs; o++)
+        {
+            audio_block_t *out = NULL;
+            // as receiveWritable() would, without the copy
+            if (o == 0 && from < INPUTS && in[from] && in[from]->ref_count == 1)
+                std::swap(out, in[from]);
+            else
+                out = allocate();
+            if (!out)
+                continue;
+            transmit(out, o);
+            release(out);
+        }
+        for (int i = 0; i < INPUTS; i++)
+            if (in[i])
+                release(in[i]);
+        while (queue.size() < held)
+            queue.push_back(allocate());
+    }
+    uint8_t outputs, inPlace, held;
+
+private:
+    audio_block_t *inputQueueArray[INPUTS];
+    std::vector<audio_block_t *> queue;
+};
+
+// Peak blocks in use running the graph in its schedule order
+template <size_t N, size_t E>
+static unsigned int simulate(const AudioGraph::Graph<N, E> &g, const AudioGraph::Schedule<N, E> &s)
+{
+    AudioMemory(NATIVE_AUDIO_MAX_BLOCKS);
+    uint8_t outputs[N] = {};
+    for (const AudioGraph::Edge &e : g.edges)
+        if (e.kind != CONTROL && e.output >= outputs[e.src])
+            outputs[e.src] = e.output + 1;
+    std::vector<std::unique_ptr<GraphNode>> nodes(N);
+    for (size_t step = 0; step < N; step++)
+        nodes[s.order[step]].reset(new GraphNode(outputs[s.order[step]], g.nodes[s.order[step]]));
+    std::vector<std::unique_ptr<AudioConnection>> connections;
+    for (const AudioGraph::Edge &e : g.edges)
+        if (e.kind != CONTROL)
+            connections.emplace_back(new AudioConnection(*nodes[e.src], e.output, *nodes[e.dst], e.input));
+    for (int b = 0; b < 4; b++)
+        AudioStream::update_all();
+    connections.clear();
+    nodes.clear();
+    return AudioMemoryUsageMax();
+}
+
+static constexpr AudioGraph::Graph<4, 3> chain = {
+    {{"a", 0}, {"b", 0}, {"c", 0}, {"d", 0}},
+    {{0, 0, 1, 0, AUDIO}, {1, 0, 2, 0, AUDIO}, {2, 0, 3, 0, AUDIO}}};
+
+// Declared backwards, with a control read and a feedback edge
+static constexpr AudioGraph::Graph<4, 4> reversed = {
+    {{"out", 0}, {"filter", 0}, {"osc", 0}, {"dc", 0}},
+    {{2, 0, 1, 0, AUDIO}, {1, 0, 0, 0, AUDIO}, {3, 0, 2, 1, CONTROL}, {1, 1, 2, 0, FEEDBACK}}};
+
+static constexpr AudioGraph::Graph<2, 2> loop = {
+    {{"a", 0}, {"b", 0}},
+    {{0, 0, 1, 0, AUDIO}, {1, 0, 0, 0, AUDIO}}};
+
+// A tap that feeds two readers, one early and one at the end
+static constexpr AudioGraph::Graph<5, 4> fanout = {
+    {{"src", 0}, {"a", 0}, {"b", 0}, {"c", 0}, {"sum", 0}},
+    {{0, 0, 1, 0, AUDIO}, {1, 0, 2, 0, AUDIO}, {2, 0, 4, 0, AUDIO}, {0, 0, 4, 1, AUDIO}}};
+
+// The same chain working in place, then with a node that releases its
+// input first and one holding two blocks
+static constexpr AudioGraph::Graph<4, 3> inPlaceChain = {
+    {{"a", 0}, {"b", 0, 0}, {"c", 0, AudioGraph::FIRST_INPUT}, {"d", 0, 0}},
+    {{0, 0, 1, 0, AUDIO}, {1, 0, 2, 0, AUDIO}, {2, 0, 3, 0, AUDIO}}};
+
+static constexpr AudioGraph::Graph<4, 4> stereo = {
+    {{"a", 0}, {"ensemble", 0, AudioGraph::ALL_INPUTS}, {"mixer", 0, AudioGraph::FIRST_INPUT}, {"out", 0, 0, 2}},
+    {{0, 0, 1, 0, AUDIO}, {1, 0, 2, 0, AUDIO}, {1, 1, 2, 1, AUDIO}, {2, 0, 3, 0, AUDIO}}};
+
+void test_sort_and_feedback()
+{
+    constexpr auto c = AudioGraph::compile(chain);
+    static_assert(c.acyclic && c.inNodeOrder, "a chain keeps its order");
+    // each block is released by its reader while the next is sent
+    static_assert(c.blocks == 2, "a chain passes two blocks along");
+
+    constexpr auto r = AudioGraph::compile(reversed);
+    static_assert(r.acyclic && !r.inNodeOrder, "sorted");
+    for (int n = 0; n < 4; n++)
+        TEST_ASSERT_EQUAL_UINT(3 - n, r.order[n]);
+    // the feedback block is held from the filter to the oscillator in the
+    // next cycle, while the filter's other output goes to out
+    TEST_ASSERT_TRUE(r.block[1] != r.block[3]);
+    TEST_ASSERT_EQUAL_UINT8(AudioGraph::NO_BLOCK, r.block[2]);
+    TEST_ASSERT_EQUAL_UINT(r.blocks, simulate(reversed, r));
+
+    constexpr auto l = AudioGraph::compile(loop);
+    static_assert(!l.acyclic, "a loop needs a feedback edge");
+
+    constexpr auto f = AudioGraph::compile(fanout);
+    TEST_ASSERT_EQUAL_UINT8(f.block[0], f.block[3]);
+    TEST_ASSERT_EQUAL_UINT8(3, f.blocks);
+    TEST_ASSERT_EQUAL_UINT(f.blocks, simulate(fanout, f));
+}
+
+void test_in_place()
+{
+    constexpr auto c = AudioGraph::compile(inPlaceChain);
+    static_assert(c.blocks == 1, "one block passed down the chain");
+    TEST_ASSERT_EQUAL_UINT(c.blocks, simulate(inPlaceChain, c));
+
+    // the mixer takes one of the ensemble's outputs, the ensemble's input
+    // is gone before it allocates them
+    constexpr auto s = AudioGraph::compile(stereo);
+    static_assert(s.blocks == 2 && s.held == 2, "two blocks at once, two queued");
+    TEST_ASSERT_EQUAL_UINT(s.blocks + s.held, simulate(stereo, s));
+}
+
+template <uint8_t TIMBRES, uint8_t VOICES>
+static void report(bool print)
+{
+    typedef SynthGraph::Config<TIMBRES, VOICES> C;
+    static constexpr auto g = C::graph();
+    static constexpr auto s = C::schedule();
+    static_assert(s.acyclic, "no feedback in the synth");
+    static_assert(s.inNodeOrder, "node order is a schedule");
+    if (print)
+    {
+        std::cout << "schedule, " << (int)TIMBRES << " timbres x " << (int)VOICES << " voices:" << std::endl;
+        for (size_t n = 0; n < C::NODES; n++)
+        {
+            const AudioGraph::Node &node = g.nodes[s.order[n]];
+            std::cout << std::setw(4) << n << "  " << node.name << "[" << (int)node.instance << "]";
+            for (size_t e = 0; e < C::EDGES; e++)
+            {
+                const AudioGraph::Edge &edge = g.edges[e];
+                if (edge.dst != s.order[n])
+                    continue;
+                const AudioGraph::Node &src = g.nodes[edge.src];
+                std::cout << "  " << (int)edge.input << "<" << src.name << "[" << (int)src.instance << "]";
+                if (edge.kind == CONTROL)
+                    std::cout << ":ctl";
+                else
+                    std::cout << ":b" << (int)s.block[e];
+            }
+            std::cout << std::endl;
+        }
+    }
+    const unsigned int run = simulate(g, s);
+    std::cout << (int)TIMBRES << " timbres x " << std::setw(2) << (int)VOICES << " voices: " << std::setw(3) << C::NODES
+              << " objects, " << std::setw(3) << C::EDGES << " edges, peak " << (int)s.blocks << " blocks + "
+              << s.held << " held (run: " << run << "), AudioMemory(" << C::audioMemory() << ")" << std::endl;
+    TEST_ASSERT_EQUAL_UINT(s.blocks + s.held, run);
+}
+
+void test_synth_schedules()
+{
+    // the configuration Global builds
+    report<2, 12>(true);
+    report<1, 1>(false);
+    report<1, 4>(false);
+    report<1, 8>(false);
+    report<1, 12>(false);
+    report<2, 16>(false);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_sort_and_feedback);
+    RUN_TEST(test_in_place);
+    RUN_TEST(test_synth_schedules);
+    UNITY_END();
+}
@@ -0,0 +1,184 @@
+//
+// AudioFilterLadderTS: passband and stopband response, and host timing per
+// voice next to AudioFilterStateVariableTS.
+//
+#include <unity.h>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <math.h>
+#include "AudioTestNodes.h"
+#include "../../TSynth/block_tags.cpp"
+#include "../../TSynth/filter_ladder.cpp"
+#include "../../TSynth/filter_variable.cpp"
+
+static const int VOICES = 12;
+static const int BLOCKS = 400;
+
+void setUp() {}
+void tearDown() {}
+
+// Sine at a frequency in Hz given by context, well below the saturator
+static int16_t sine(uint32_t t, void *context)
+{
+    const float freq = (float)(intptr_t)context;
+    return (int16_t)(3000.0f * sinf(2.0f * (float)M_PI * freq * t / AUDIO_SAMPLE_RATE_EXACT));
+}
+
+static int16_t saw(uint32_t t, void *context)
+{
+    const float freq = 110.0f * powf(2.0f, (intptr_t)context / 12.0f);
+    const float phase = fmodf(t * freq / AUDIO_SAMPLE_RATE_EXACT, 1.0f);
+    return (int16_t)((phase * 2.0f - 1.0f) * 16000.0f);
+}
+
+static int16_t lfo(uint32_t t, void *context)
+{
+    return (int16_t)(0.4f * 32767.0f * sinf(2.0f * (float)M_PI * 4.0f * t / AUDIO_SAMPLE_RATE_EXACT));
+}
+
+// Output level relative to the input sine, in dB, after settling
+static double gainDb(float freq, float cutoff, float q, bool oversample)
+{
+    AudioTestSource source(sine, (void *)(intptr_t)freq);
+    AudioFilterLadderTS ladder;
+    AudioTestSink sink;
+    AudioConnection c1(source, 0, ladder, 0);
+    AudioConnection c2(ladder, 0, sink, 0);
+    ladder.frequency(cutoff);
+    ladder.resonance(q);
+    ladder.oversample(oversample);
+    for (int b = 0; b < 100; b++)
+        AudioStream::update_all();
+    double sum = 0;
+    const size_t from = 50 * AUDIO_BLOCK_SAMPLES;
+    for (size_t i = from; i < sink.samples.size(); i++)
+        sum += (double)sink.samples[i] * sink.samples[i];
+    const double rms = sqrt(sum / (sink.samples.size() - from));
+    return 20.0 * log10(rms / (3000.0 / sqrt(2.0)));
+}
+
+void test_passband_and_rolloff()
+{
+    AudioMemory(16);
+    for (bool os : {false, true})
+    {
+        const double pass = gainDb(100, 2000, 0.7, os);
+        const double corner = gainDb(2000, 2000, 0.7, os);
+        const double stop = gainDb(8000, 2000, 0.7, os);
+        std::cout << (os ? "2x oversampled" : "single rate") << ": 100Hz " << pass << " dB, 2kHz " << corner
+                  << " dB, 8kHz " << stop << " dB" << std::endl;
+        TEST_ASSERT_FLOAT_WITHIN(0.5, 0.0, pass);
+        // Four poles at the corner: -12dB, then 24dB/octave
+        TEST_ASSERT_FLOAT_WITHIN(1.0, -12.0, corner);
+        TEST_ASSERT_LESS_THAN(-40.0, stop);
+    }
+    // Feedback lifts the corner well above the passband
+    TEST_ASSERT_GREATER_THAN(gainDb(100, 2000, 15, false) + 12.0, gainDb(2000, 2000, 15, false));
+}
+
+// Largest sample to sample change in samples [from, to)
+static int maxStep(const std::vector<int16_t> &s, size_t from, size_t to)
+{
+    int step = 0;
+    for (size_t i = from; i < to; i++)
+        step = std::max(step, abs(s[i] - s[i - 1]));
+    return step;
+}
+
+// Turning oversampling back on mid-note interpolates from the last input,
+// not from where it was turned off, so there's no step in the output
+void test_oversample_switch_is_smooth()
+{
+    AudioMemory(16);
+    AudioTestSource source(sine, (void *)(intptr_t)100);
+    AudioFilterLadderTS ladder;
+    AudioTestSink sink;
+    AudioConnection c1(source, 0, ladder, 0);
+    AudioConnection c2(ladder, 0, sink, 0);
+    ladder.frequency(15000);
+    ladder.resonance(0.7);
+    ladder.oversample(true);
+    for (int b = 0; b < 20; b++)
+        AudioStream::update_all();
+    ladder.oversample(false);
+    for (int b = 0; b < 2; b++)
+        AudioStream::update_all();
+    const size_t on = sink.samples.size();
+    ladder.oversample(true);
+    for (int b = 0; b < 2; b++)
+        AudioStream::update_all();
+    const int steady = maxStep(sink.samples, 10 * AUDIO_BLOCK_SAMPLES, on - 1);
+    const int around = maxStep(sink.samples, on - 4, on + 4);
+    std::cout << "oversampling on: step " << around << ", steady " << steady << std::endl;
+    TEST_ASSERT_LESS_OR_EQUAL(steady + steady / 10, around);
+}
+
+static void configure(AudioFilterStateVariableTS &filter, bool oversample) {}
+static void configure(AudioFilterLadderTS &filter, bool oversample) { filter.oversample(oversample); }
+
+// Host microseconds per voice per block, for 12 voices with a swept cutoff
+template <class Filter>
+static double timeBank(bool oversample, unsigned int &missing)
+{
+    AudioTestSource *audio[VOICES];
+    AudioTestSource *control[VOICES];
+    Filter *filter[VOICES];
+    AudioTestSink *out[VOICES];
+    AudioConnection *connections[VOICES * 3];
+    for (int i = 0; i < VOICES; i++)
+    {
+        audio[i] = new AudioTestSource(saw, (void *)(intptr_t)i);
+        control[i] = new AudioTestSource(lfo);
+    }
+    // Constructed after the sources so they update after them
+    for (int i = 0; i < VOICES; i++)
+    {
+        filter[i] = new Filter();
+        out[i] = new AudioTestSink();
+        filter[i]->frequency(800.0f);
+        filter[i]->resonance(4.0f);
+        filter[i]->octaveControl(4.0f);
+        configure(*filter[i], oversample);
+        connections[i * 3] = new AudioConnection(*audio[i], 0, *filter[i], 0);
+        connections[i * 3 + 1] = new AudioConnection(*control[i], 0, *filter[i], 1);
+        connections[i * 3 + 2] = new AudioConnection(*filter[i], 0, *out[i], 0);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int b = 0; b < BLOCKS; b++)
+        AudioStream::update_all();
+    auto end = std::chrono::steady_clock::now();
+    for (int i = 0; i < VOICES; i++)
+    {
+        missing += out[i]->missing;
+        delete connections[i * 3];
+        delete connections[i * 3 + 1];
+        delete connections[i * 3 + 2];
+        delete filter[i];
+        delete out[i];
+        delete audio[i];
+        delete control[i];
+    }
+    return std::chrono::duration<double, std::micro>(end - start).count() / BLOCKS / VOICES;
+}
+
+void test_cost_per_voice()
+{
+    AudioMemory(128);
+    unsigned int missing = 0;
+    const double svf = timeBank<AudioFilterStateVariableTS>(false, missing);
+    const double ladder = timeBank<AudioFilterLadderTS>(false, missing);
+    const double ladder2x = timeBank<AudioFilterLadderTS>(true, missing);
+    std::cout << "host us per voice per block: state variable " << std::fixed << std::setprecision(3) << svf
+              << ", ladder " << ladder << ", ladder 2x " << ladder2x << std::endl;
+    TEST_ASSERT_EQUAL_INT(0, missing);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_passband_and_rolloff);
+    RUN_TEST(test_oversample_switch_is_smooth);
+    RUN_TEST(test_cost_per_voice);
+    UNITY_END();
+}
@@ -0,0 +1,109 @@
+//
+// tools/map_report.h on an excerpt of a Teensy 4.1 linker map: sections
+// counted by the region they're linked at, long names split over two
+// lines, archive members, and the debug sections left out.
+//
+#include <unity.h>
+#include <sstream>
+#include "../../tools/map_report.h"
+
+using namespace MapReport;
+
+void setUp() {}
+void tearDown() {}
+
+static const char *const MAP =
+    "Archive member included to satisfy reference by file (symbol)\n"
+    "\n"
+    "Discarded input sections\n"
+    "\n"
+    " .text._ZN12AudioMixer4TS4gainEif\n"
+    "                0x00000000       0x40 .pio/build/teensy41/src/mixer_ts.cpp.o\n"
+    "\n"
+    "Linker script and memory map\n"
+    "\n"
+    "LOAD .pio/build/teensy41/src/mixer_ts.cpp.o\n"
+    "\n"
+    ".text.progmem   0x60000000     0x1200\n"
+    " *(.flashconfig)\n"
+    " .text.progmem  0x60000000      0x200 .pio/build/teensy41/src/TSynth.cpp.o\n"
+    "                0x60000000                setupHardware()\n"
+    " .progmem       0x60000200     0x1000 .pio/build/teensy41/src/Constants.cpp.o\n"
+    "\n"
+    ".text.itcm      0x00000000     0x9000 load address 0x60001200\n"
+    " *(.fastrun)\n"
+    " .fastrun       0x00000000      0x300 .pio/build/teensy41/src/mixer_ts.cpp.o\n"
+    "                0x00000000                AudioMixer4TS::update()\n"
+    " .text._ZN27AudioSynthWaveformModulatedTS6updateEv\n"
+    "                0x00000300      0x800 .pio/build/teensy41/src/synth_waveform.cpp.o\n"
+    " .text          0x00000b00      0x100 .pio/build/teensy41/lib1a2/libAudio.a(synth_sine.cpp.o)\n"
+    " .text          0x00000c00      0x080 .pio/build/teensy41/lib1a2/libAudio.a(mixer.cpp.o)\n"
+    " *fill*         0x00000c80     0x8380 \n"
+    "\n"
+    ".data           0x20000000      0x500 load address 0x6000a200\n"
+    " .rodata.fastdata\n"
+    "                0x20000000      0x400 .pio/build/teensy41/src/Constants.cpp.o\n"
+    " .data          0x20000400      0x100 .pio/build/teensy41/src/TSynth.cpp.o\n"
+    "\n"
+    ".bss            0x20000500     0x2000\n"
+    " COMMON         0x20000500     0x2000 .pio/build/teensy41/src/TSynth.cpp.o\n"
+    "\n"
+    ".bss.dma        0x20200000      0x800\n"
+    " .bss.dma       0x20200000      0x800 .pio/build/teensy41/src/effect_envelope.cpp.o\n"
+    "\n"
+    ".debug_info     0x00000000    0x12345\n"
+    " .debug_info    0x00000000    0x12345 .pio/build/teensy41/src/mixer_ts.cpp.o\n"
+    ".comment        0x00000000       0x30\n"
+    " .comment       0x00000000       0x30 .pio/build/teensy41/src/TSynth.cpp.o\n";
+
+static Report parseMap(bool archives)
+{
+    std::istringstream in(MAP);
+    return parse(in, archives);
+}
+
+void test_regions_by_address()
+{
+    const Report r = parseMap(false);
+    TEST_ASSERT_EQUAL_UINT(0x9000, r.total.bytes[ITCM]);
+    TEST_ASSERT_EQUAL_UINT(0x2500, r.total.bytes[DTCM]);
+    TEST_ASSERT_EQUAL_UINT(0x800, r.total.bytes[OCRAM]);
+    TEST_ASSERT_EQUAL_UINT(0x1200, r.total.bytes[FLASH]);
+
+    const Usage &tsynth = r.modules.at("TSynth.cpp");
+    TEST_ASSERT_EQUAL_UINT(0x200, tsynth.bytes[FLASH]);
+    TEST_ASSERT_EQUAL_UINT(0x2100, tsynth.bytes[DTCM]);
+    const Usage &constants = r.modules.at("Constants.cpp");
+    TEST_ASSERT_EQUAL_UINT(0x1000, constants.bytes[FLASH]);
+    TEST_ASSERT_EQUAL_UINT(0x400, constants.bytes[DTCM]);
+    TEST_ASSERT_EQUAL_UINT(0x800, r.modules.at("effect_envelope.cpp").bytes[OCRAM]);
+}
+
+void test_split_names_and_debug()
+{
+    const Report r = parseMap(false);
+    // the discarded section and the debug info don't count
+    TEST_ASSERT_EQUAL_UINT(0x300, r.modules.at("mixer_ts.cpp").all());
+    TEST_ASSERT_EQUAL_UINT(0x800, r.modules.at("synth_waveform.cpp").bytes[ITCM]);
+    TEST_ASSERT_EQUAL_UINT(7, r.modules.size());
+}
+
+void test_archives()
+{
+    const Report members = parseMap(false);
+    TEST_ASSERT_EQUAL_UINT(0x100, members.modules.at("libAudio.a(synth_sine.cpp)").bytes[ITCM]);
+    TEST_ASSERT_EQUAL_UINT(0x80, members.modules.at("libAudio.a(mixer.cpp)").bytes[ITCM]);
+
+    const Report grouped = parseMap(true);
+    TEST_ASSERT_EQUAL_UINT(0x180, grouped.modules.at("libAudio.a").bytes[ITCM]);
+    TEST_ASSERT_EQUAL_UINT(6, grouped.modules.size());
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_regions_by_address);
+    RUN_TEST(test_split_names_and_debug);
+    RUN_TEST(test_archives);
+    UNITY_END();
+}
@@ -0,0 +1,228 @@
+//
+// AudioMixerBusTS against the mixer trees it replaced: a timbre's 12 voices
+// through three mixers into a fourth, at velocity and mixer level gains.
+// The tree here is AudioMixer4TS, which mixes audio blocks exactly as the
+// stock AudioMixer4 did. The same sum to within rounding, no clipping at
+// the intermediate stages, the stereo layout, and the time each takes.
+//
+#include <unity.h>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <math.h>
+#include "AudioTestNodes.h"
+#include "../../TSynth/block_tags.cpp"
+#include "../../TSynth/mixer_ts.cpp"
+#include "../../TSynth/mixer_bus.cpp"
+
+static const int VOICES = 12;
+static const float MIXER_LEVEL = 0.28f;
+
+void setUp() {}
+void tearDown() {}
+
+// One period of a sine, read round and round
+struct Wave
+{
+    std::vector<int16_t> table;
+    Wave(int period, float amplitude, float phase) : table(period)
+    {
+        for (int i = 0; i < period; i++)
+            table[i] = (int16_t)(amplitude * sinf(2.0f * (float)M_PI * i / period + phase));
+    }
+};
+
+static int16_t wave(uint32_t t, void *context)
+{
+    const Wave *w = (const Wave *)context;
+    return w->table[t % w->table.size()];
+}
+
+static std::vector<std::unique_ptr<Wave>> voiceWaves(float amplitude)
+{
+    std::vector<std::unique_ptr<Wave>> waves;
+    for (int v = 0; v < VOICES; v++)
+        waves.emplace_back(new Wave(37 + 11 * v, amplitude, 0.5f * v));
+    return waves;
+}
+
+static float velocity(int v)
+{
+    return (0.4f + 0.05f * v) * MIXER_LEVEL;
+}
+
+// Twelve voices as the Global used to mix them, or on one bus, each with
+// its sink declared last so it updates after the mixers
+struct Voices
+{
+    std::vector<std::unique_ptr<AudioTestSource>> sources;
+    std::vector<std::unique_ptr<AudioConnection>> connections;
+
+    Voices(const std::vector<std::unique_ptr<Wave>> &waves)
+    {
+        for (int v = 0; v < VOICES; v++)
+            sources.emplace_back(new AudioTestSource(wave, waves[v].get()));
+    }
+    void silent(bool s)
+    {
+        for (auto &source : sources)
+            source->setSilent(s);
+    }
+    double run(int blocks)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int b = 0; b < blocks; b++)
+            AudioStream::update_all();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / blocks;
+    }
+};
+
+struct Tree : Voices
+{
+    AudioMixer4TS voiceMixer[3];
+    AudioMixer4TS voiceMixerM;
+    AudioTestSink out;
+
+    Tree(const std::vector<std::unique_ptr<Wave>> &waves, float level = MIXER_LEVEL) : Voices(waves)
+    {
+        for (int v = 0; v < VOICES; v++)
+        {
+            connections.emplace_back(new AudioConnection(*sources[v], 0, voiceMixer[v / 4], v % 4));
+            voiceMixer[v / 4].gain(v % 4, velocity(v));
+        }
+        for (int m = 0; m < 3; m++)
+        {
+            connections.emplace_back(new AudioConnection(voiceMixer[m], 0, voiceMixerM, m));
+            voiceMixerM.gain(m, level);
+        }
+        connections.emplace_back(new AudioConnection(voiceMixerM, 0, out, 0));
+    }
+};
+
+struct Bus : Voices
+{
+    AudioMixerBusTS<VOICES> voiceMixer;
+    AudioTestSink out;
+
+    Bus(const std::vector<std::unique_ptr<Wave>> &waves, float level = MIXER_LEVEL) : Voices(waves)
+    {
+        for (int v = 0; v < VOICES; v++)
+        {
+            connections.emplace_back(new AudioConnection(*sources[v], 0, voiceMixer, v));
+            voiceMixer.gain(v, velocity(v));
+        }
+        voiceMixer.gain(level);
+        connections.emplace_back(new AudioConnection(voiceMixer, 0, out, 0));
+    }
+};
+
+void test_same_sum_as_tree()
+{
+    AudioMemory(40);
+    const auto waves = voiceWaves(20000.0f);
+    Tree tree(waves);
+    Bus bus(waves);
+    // truncating as the tree does, test_float_kernels has the float sum
+    bus.voiceMixer.useFloat(false);
+    tree.run(50);
+    bus.run(50);
+    TEST_ASSERT_EQUAL_UINT(tree.out.samples.size(), bus.out.samples.size());
+    int worst = 0;
+    for (size_t i = 0; i < tree.out.samples.size(); i++)
+        worst = std::max(worst, abs(tree.out.samples[i] - bus.out.samples[i]));
+    // the tree truncates each of the three sub mixes at the mixer level
+    std::cout << "bus against tree: max difference " << worst << std::endl;
+    TEST_ASSERT_LESS_OR_EQUAL(3, worst);
+}
+
+void test_headroom()
+{
+    AudioMemory(40);
+    // full scale voices at unity gain, turned down once at the end
+    const auto waves = voiceWaves(32000.0f);
+    const float level = 1.0f / VOICES;
+    Tree tree(waves, level);
+    Bus bus(waves, level);
+    for (int v = 0; v < VOICES; v++)
+    {
+        tree.voiceMixer[v / 4].gain(v % 4, 1.0f);
+        bus.voiceMixer.gain(v, 1.0f);
+    }
+    tree.run(50);
+    bus.run(50);
+    int treeWorst = 0, busWorst = 0;
+    for (size_t i = 0; i < bus.out.samples.size(); i++)
+    {
+        float exact = 0;
+        for (int v = 0; v < VOICES; v++)
+            exact += wave(i, waves[v].get());
+        exact *= level;
+        treeWorst = std::max(treeWorst, (int)fabsf(tree.out.samples[i] - exact));
+        busWorst = std::max(busWorst, (int)fabsf(bus.out.samples[i] - exact));
+    }
+    // the tree's first stage clips at four voices
+    std::cout << "error against the exact sum: tree " << treeWorst << ", bus " << busWorst << std::endl;
+    // the bus only rounds its gain to 16.16
+    TEST_ASSERT_LESS_OR_EQUAL(2, busWorst);
+    TEST_ASSERT_GREATER_THAN(1000, treeWorst);
+}
+
+void test_stereo()
+{
+    AudioMemory(16);
+    Wave a(50, 10000.0f, 0.0f), b(70, 8000.0f, 1.0f);
+    AudioTestSource left0(wave, &a), right0(wave, &b), left1(wave, &b), right1(wave, &a);
+    AudioMixerBusTS<3, 2> mixer;
+    AudioTestSink outL, outR;
+    // source 2 is left unconnected
+    AudioConnection c0(left0, 0, mixer, 0), c1(right0, 0, mixer, 1), c2(left1, 0, mixer, 2), c3(right1, 0, mixer, 3);
+    AudioConnection c4(mixer, 0, outL, 0), c5(mixer, 1, outR, 0);
+    mixer.gain(1, 0.5f);
+    AudioStream::update_all();
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+    {
+        TEST_ASSERT_INT_WITHIN(1, a.table[i % 50] + b.table[i % 70] / 2, outL.samples[i]);
+        TEST_ASSERT_INT_WITHIN(1, b.table[i % 70] + a.table[i % 50] / 2, outR.samples[i]);
+    }
+    // a source turned down is skipped
+    mixer.gain(0, 0.0f);
+    mixer.gain(1, 0.0f);
+    AudioStream::update_all();
+    TEST_ASSERT_EQUAL_UINT(1, outL.missing);
+}
+
+void test_timing()
+{
+    AudioMemory(40);
+    // Averaged over 12 runs of the pair, both mixing the same voices
+    const auto waves = voiceWaves(20000.0f);
+    Tree tree(waves);
+    tree.silent(true);
+    Bus bus(waves);
+    bus.silent(true);
+    double us[2] = {0, 0};
+    for (int r = 0; r < 12; r++)
+    {
+        tree.silent(false);
+        us[0] += tree.run(200);
+        tree.silent(true);
+        bus.silent(false);
+        us[1] += bus.run(200);
+        bus.silent(true);
+    }
+    // for information only: host wall clock time says nothing reliable
+    // about the Teensy, and varies with the build and the machine
+    std::cout << "host us/block including 12 sources and the sink: mixer tree " << us[0] / 12 << ", bus "
+              << us[1] / 12 << std::endl;
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_same_sum_as_tree);
+    RUN_TEST(test_headroom);
+    RUN_TEST(test_stereo);
+    RUN_TEST(test_timing);
+    UNITY_END();
+}
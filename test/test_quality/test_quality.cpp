@@ -0,0 +1,215 @@
+//
+// The quality levels in Quality.h: QualityGovernor stepping down on load
+// and back up with hysteresis, then the state variable filter at each
+// oversampling factor a level uses, its gain at the corner, fixed against
+// float and the host time per block for 12 voices.
+//
+#include <unity.h>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <math.h>
+#include "AudioTestNodes.h"
+#include "../../TSynth/Quality.h"
+#include "../../TSynth/block_tags.cpp"
+#include "../../TSynth/filter_variable.cpp"
+
+static const int VOICES = 12;
+static const int BLOCKS = 100;
+
+void setUp() {}
+void tearDown() {}
+
+// n checks at usage, true if any changed the level
+static bool checks(QualityGovernor &g, int n, float usage)
+{
+    bool changed = false;
+    for (int i = 0; i < n; i++)
+        changed |= g.update(usage);
+    return changed;
+}
+
+void test_governor_steps()
+{
+    QualityGovernor g(QUALITY_HIGH);
+    TEST_ASSERT_FALSE(checks(g, 100, 70.0f));
+    TEST_ASSERT_EQUAL(QUALITY_HIGH, g.level());
+
+    // each check over the limit is a level, down to eco and no further
+    TEST_ASSERT_TRUE(g.update(90.0f));
+    TEST_ASSERT_EQUAL(QUALITY_NORMAL, g.level());
+    TEST_ASSERT_TRUE(g.throttled());
+    TEST_ASSERT_TRUE(g.update(90.0f));
+    TEST_ASSERT_FALSE(g.update(90.0f));
+    TEST_ASSERT_EQUAL(QUALITY_ECO, g.level());
+
+    // back up one level per run of calm checks, a busy one restarts the run
+    TEST_ASSERT_FALSE(checks(g, QualityGovernor::RECOVER_CHECKS - 1, 40.0f));
+    TEST_ASSERT_FALSE(g.update(70.0f));
+    TEST_ASSERT_FALSE(checks(g, QualityGovernor::RECOVER_CHECKS - 1, 40.0f));
+    TEST_ASSERT_TRUE(g.update(40.0f));
+    TEST_ASSERT_EQUAL(QUALITY_NORMAL, g.level());
+    TEST_ASSERT_FALSE(checks(g, QualityGovernor::RECOVER_CHECKS - 1, 40.0f));
+    TEST_ASSERT_TRUE(g.update(40.0f));
+    TEST_ASSERT_EQUAL(QUALITY_HIGH, g.level());
+    TEST_ASSERT_FALSE(g.throttled());
+
+    // never above the ceiling
+    TEST_ASSERT_FALSE(checks(g, 1000, 10.0f));
+    g.setCeiling(QUALITY_ECO);
+    TEST_ASSERT_FALSE(checks(g, 1000, 10.0f));
+    TEST_ASSERT_EQUAL(QUALITY_ECO, g.level());
+}
+
+// Stepping up into a level that is too much straight away doubles the wait
+// for the next try, holding it puts the wait back
+void test_governor_backoff()
+{
+    QualityGovernor g(QUALITY_NORMAL);
+    const int recover = QualityGovernor::RECOVER_CHECKS;
+    g.update(90.0f);
+    checks(g, recover, 40.0f);
+    TEST_ASSERT_EQUAL(QUALITY_NORMAL, g.level());
+
+    int wait = recover;
+    for (int bounce = 0; bounce < 8; bounce++)
+    {
+        TEST_ASSERT_TRUE(g.update(90.0f));
+        wait = std::min(wait * 2, (int)QualityGovernor::MAX_RECOVER_CHECKS);
+        TEST_ASSERT_FALSE(checks(g, wait - 1, 40.0f));
+        TEST_ASSERT_TRUE(g.update(40.0f));
+    }
+    TEST_ASSERT_EQUAL((int)QualityGovernor::MAX_RECOVER_CHECKS, wait);
+
+    // held for the whole wait: the next step down is load, not a bounce
+    checks(g, wait, 40.0f);
+    TEST_ASSERT_TRUE(g.update(90.0f));
+    TEST_ASSERT_FALSE(checks(g, recover - 1, 40.0f));
+    TEST_ASSERT_TRUE(g.update(40.0f));
+}
+
+void test_waveforms()
+{
+    TEST_ASSERT_EQUAL(WAVEFORM_BANDLIMIT_SAWTOOTH, qualityWaveform(WAVEFORM_BANDLIMIT_SAWTOOTH, QUALITY_NORMAL));
+    TEST_ASSERT_EQUAL(WAVEFORM_SAWTOOTH, qualityWaveform(WAVEFORM_BANDLIMIT_SAWTOOTH, QUALITY_ECO));
+    TEST_ASSERT_EQUAL(WAVEFORM_PULSE, qualityWaveform(WAVEFORM_BANDLIMIT_PULSE, QUALITY_ECO));
+    TEST_ASSERT_EQUAL(WAVEFORM_SINE, qualityWaveform(WAVEFORM_SINE, QUALITY_ECO));
+}
+
+// Normal plays every control rate the filter takes as the patch has it
+void test_normal_control_rates()
+{
+    AudioFilterStateVariableTS filter;
+    filter.controlRate(255);
+    const QualitySettings &normal = QUALITY_SETTINGS[QUALITY_NORMAL];
+    TEST_ASSERT_EQUAL(1, normal.minControlRate);
+    TEST_ASSERT_EQUAL(filter.controlRate(), normal.maxControlRate);
+    for (int q = 0; q < QUALITY_LEVELS; q++)
+        TEST_ASSERT_TRUE(QUALITY_SETTINGS[q].maxControlRate <= filter.controlRate());
+}
+
+static int16_t sine(uint32_t t, void *context)
+{
+    const float freq = *(const float *)context;
+    return (int16_t)(16000.0f * sinf(2.0f * (float)M_PI * freq * t / AUDIO_SAMPLE_RATE_EXACT));
+}
+
+static double rms(const std::vector<int16_t> &s, size_t first)
+{
+    double sum = 0;
+    for (size_t i = first; i < s.size(); i++)
+        sum += (double)s[i] * s[i];
+    return sqrt(sum / (s.size() - first));
+}
+
+// Lowpass gain in dB for a sine at the corner frequency, fixed and float
+static void cornerGain(uint8_t oversample, float freq, double db[2], int &diff)
+{
+    AudioTestSource in(sine, &freq);
+    AudioFilterStateVariableTS filter[2];
+    AudioTestSink out[2];
+    std::vector<std::unique_ptr<AudioConnection>> connections;
+    for (int k = 0; k < 2; k++)
+    {
+        filter[k].frequency(freq);
+        filter[k].resonance(0.707f);
+        filter[k].oversample(oversample);
+        filter[k].useFloat(k == 1);
+        connections.emplace_back(new AudioConnection(in, 0, filter[k], 0));
+        connections.emplace_back(new AudioConnection(filter[k], 0, out[k], 0));
+    }
+    for (int b = 0; b < blocksOf128(40); b++)
+        AudioStream::update_all();
+    const size_t settled = out[0].samples.size() / 2;
+    const double input = 16000.0 / sqrt(2.0);
+    diff = 0;
+    for (size_t i = 0; i < out[0].samples.size(); i++)
+        diff = std::max(diff, abs(out[0].samples[i] - out[1].samples[i]));
+    for (int k = 0; k < 2; k++)
+        db[k] = 20.0 * log10(rms(out[k].samples, settled) / input);
+}
+
+// Every voice's filter on the same input, microseconds per block
+static double timeBank(uint8_t oversample, bool useFloat)
+{
+    float freq = 220.0f;
+    AudioTestSource in(sine, &freq);
+    AudioFilterStateVariableTS filter[VOICES];
+    AudioTestSink out[VOICES];
+    std::vector<std::unique_ptr<AudioConnection>> connections;
+    for (int v = 0; v < VOICES; v++)
+    {
+        filter[v].frequency(1000.0f + 300.0f * v);
+        filter[v].resonance(3.0f);
+        filter[v].oversample(oversample);
+        filter[v].useFloat(useFloat);
+        connections.emplace_back(new AudioConnection(in, 0, filter[v], 0));
+        connections.emplace_back(new AudioConnection(filter[v], 0, out[v], 0));
+    }
+    const auto start = std::chrono::steady_clock::now();
+    for (int b = 0; b < blocksOf128(BLOCKS); b++)
+        AudioStream::update_all();
+    const std::chrono::duration<double, std::micro> took = std::chrono::steady_clock::now() - start;
+    return took.count() / blocksOf128(BLOCKS);
+}
+
+void test_svf_oversampling()
+{
+    AudioMemory(64);
+    const uint8_t factors[] = {1, 2, 4};
+    // the 1x filter can't reach past fs/6, so its top corner is lower.
+    // Above a few kHz the input ramp and the averaging of the steps into
+    // each output take some level off on top of the filter's 3 dB, the
+    // more steps the more, so only the low corner is held to 3 dB.
+    const float corners[][2] = {{1000.0f, 6000.0f}, {1000.0f, 10000.0f}, {1000.0f, 10000.0f}};
+    std::cout << "oversample  corner Hz  fixed dB  float dB  max diff  fixed us  float us" << std::endl;
+    for (int f = 0; f < 3; f++)
+    {
+        const double fixedUs = timeBank(factors[f], false), floatUs = timeBank(factors[f], true);
+        for (float corner : corners[f])
+        {
+            double db[2];
+            int diff;
+            cornerGain(factors[f], corner, db, diff);
+            std::cout << std::fixed << std::setprecision(2) << std::setw(9) << (int)factors[f] << "x"
+                      << std::setw(11) << corner << std::setw(10) << db[0] << std::setw(10) << db[1]
+                      << std::setw(10) << diff << std::setw(10) << fixedUs << std::setw(10) << floatUs
+                      << std::endl;
+            for (int k = 0; k < 2; k++)
+                TEST_ASSERT_FLOAT_WITHIN(corner < 2000.0f ? 0.25f : 2.5f, -3.0f, (float)db[k]);
+            TEST_ASSERT_LESS_OR_EQUAL(8, diff);
+        }
+    }
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_governor_steps);
+    RUN_TEST(test_governor_backoff);
+    RUN_TEST(test_waveforms);
+    RUN_TEST(test_normal_control_rates);
+    RUN_TEST(test_svf_oversampling);
+    UNITY_END();
+}
@@ -0,0 +1,160 @@
+//
+// WAVEFORM_SUPERSAW in AudioSynthWaveformModulatedTS: aliasing of the
+// polyBLEP saw against the naive one, the stereo spread against the mono
+// sum, and host timing against the same saws as separate oscillators.
+//
+#include <unity.h>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <complex>
+#include <math.h>
+#include "AudioTestNodes.h"
+#include "../../TSynth/block_tags.cpp"
+#include "../../TSynth/Detune.cpp"
+#include "../../TSynth/synth_waveform.cpp"
+
+// Tables from the Teensy Audio library, only the saws are used here
+extern "C" {
+const int16_t AudioWaveformSine[257] = {0};
+const int16_t step_table[258] = {0};
+}
+
+static const int FFT_SIZE = 4096;
+
+void setUp() {}
+void tearDown() {}
+
+static std::vector<int16_t> render(AudioSynthWaveformModulatedTS &osc, AudioTestSink &out, int blocks)
+{
+    for (int b = 0; b < blocksOf128(blocks); b++)
+        AudioStream::update_all();
+    return std::vector<int16_t>(out.samples.end() - FFT_SIZE, out.samples.end());
+}
+
+// Energy away from the harmonics of f, relative to the energy on them, in
+// dB. Hann windowed DFT, harmonics take the 4 bins either side.
+static double aliasingDb(const std::vector<int16_t> &x, double f)
+{
+    double harmonic = 0, alias = 0;
+    const double binHz = AUDIO_SAMPLE_RATE_EXACT / FFT_SIZE;
+    for (int k = 1; k < FFT_SIZE / 2; k++)
+    {
+        std::complex<double> sum = 0;
+        for (int n = 0; n < FFT_SIZE; n++)
+        {
+            const double w = 0.5 - 0.5 * cos(2 * M_PI * n / FFT_SIZE);
+            sum += w * x[n] * std::polar(1.0, -2 * M_PI * k * n / FFT_SIZE);
+        }
+        const double hz = k * binHz;
+        const double h = hz / f;
+        const bool onHarmonic = fabs(h - round(h)) * f < 4.5 * binHz;
+        (onHarmonic ? harmonic : alias) += std::norm(sum);
+    }
+    return 10.0 * log10(alias / harmonic);
+}
+
+void test_saw_is_band_limited()
+{
+    AudioMemory(16);
+    const float freq = 5271.0f;
+    double naive, blep;
+    {
+        AudioSynthWaveformModulatedTS osc;
+        AudioTestSink out;
+        AudioConnection c(osc, 0, out, 0);
+        osc.begin(1.0f, freq, WAVEFORM_SAWTOOTH);
+        naive = aliasingDb(render(osc, out, 40), freq);
+    }
+    {
+        AudioSynthWaveformModulatedTS osc;
+        AudioTestSink out;
+        AudioConnection c(osc, 0, out, 0);
+        osc.supersaw(1, 0.0f);
+        osc.begin(1.0f, freq, WAVEFORM_SUPERSAW);
+        blep = aliasingDb(render(osc, out, 40), freq);
+    }
+    std::cout << "aliasing at " << freq << "Hz: naive " << naive << " dB, polyBLEP " << blep << " dB" << std::endl;
+    TEST_ASSERT_LESS_THAN(naive - 10.0, blep);
+}
+
+void test_spread_sums_to_mono()
+{
+    AudioMemory(16);
+    std::vector<int16_t> mono;
+    {
+        AudioSynthWaveformModulatedTS osc;
+        AudioTestSink out;
+        AudioConnection c(osc, 0, out, 0);
+        osc.supersaw(7, 0.03f);
+        osc.begin(1.0f, 220.0f, WAVEFORM_SUPERSAW);
+        mono = render(osc, out, 40);
+    }
+    AudioSynthWaveformModulatedTS osc;
+    AudioTestSink left, right;
+    AudioConnection c0(osc, 0, left, 0);
+    AudioConnection c1(osc, 1, right, 0);
+    osc.supersaw(7, 0.03f);
+    osc.supersawSpread(1.0f);
+    osc.begin(1.0f, 220.0f, WAVEFORM_SUPERSAW);
+    render(osc, left, 40);
+    const std::vector<int16_t> l(left.samples.end() - FFT_SIZE, left.samples.end());
+    const std::vector<int16_t> r(right.samples.end() - FFT_SIZE, right.samples.end());
+    int worst = 0, differ = 0;
+    for (int i = 0; i < FFT_SIZE; i++)
+    {
+        worst = std::max(worst, abs(l[i] + r[i] - 2 * mono[i]));
+        if (l[i] != r[i])
+            differ++;
+    }
+    std::cout << "left + right vs 2 x mono: max difference " << worst << std::endl;
+    TEST_ASSERT_LESS_OR_EQUAL(4, worst);
+    TEST_ASSERT_GREATER_THAN(FFT_SIZE * 9 / 10, differ);
+}
+
+// 7 detuned saws for 12 voices, as one supersaw each or as 7 band limited
+// sawtooth oscillators each (what unison spends its voices on)
+void test_timing()
+{
+    const int VOICES = 12, SAWS = 7, BLOCKS = 400;
+    AudioMemory(128);
+    double us[2];
+    for (int mode = 0; mode < 2; mode++)
+    {
+        const int count = mode ? VOICES : VOICES * SAWS;
+        std::vector<AudioSynthWaveformModulatedTS> osc(count);
+        std::vector<AudioTestSink> out(count);
+        std::vector<AudioConnection *> c;
+        for (int i = 0; i < count; i++)
+        {
+            c.push_back(new AudioConnection(osc[i], 0, out[i], 0));
+            if (mode)
+            {
+                osc[i].supersaw(SAWS, 0.03f);
+                osc[i].begin(1.0f, 110.0f * (1 + i), WAVEFORM_SUPERSAW);
+            }
+            else
+            {
+                osc[i].begin(1.0f, 110.0f * (1 + i / SAWS) * (1.0f + 0.005f * (i % SAWS)), WAVEFORM_BANDLIMIT_SAWTOOTH);
+            }
+        }
+        auto start = std::chrono::steady_clock::now();
+        for (int b = 0; b < BLOCKS; b++)
+            AudioStream::update_all();
+        auto end = std::chrono::steady_clock::now();
+        us[mode] = std::chrono::duration<double, std::micro>(end - start).count() / BLOCKS;
+        for (AudioConnection *p : c)
+            delete p;
+    }
+    std::cout << "host us/block, 12 voices x 7 saws: separate oscillators " << std::fixed << std::setprecision(2)
+              << us[0] << ", supersaw " << us[1] << std::endl;
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_saw_is_band_limited);
+    RUN_TEST(test_spread_sums_to_mono);
+    RUN_TEST(test_timing);
+    UNITY_END();
+}
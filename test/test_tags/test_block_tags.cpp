@@ -0,0 +1,257 @@
+//
+// Constant tagged blocks (block_tags.h) through AudioMixer4TS, the state
+// variable filter control input and the envelope generator: the shortcuts
+// must give the same samples as the untagged blocks, and tags must never be
+// left on free blocks.
+//
+#include <unity.h>
+#include <iostream>
+#include <math.h>
+#include "AudioTestNodes.h"
+#include "../../TSynth/block_tags.cpp"
+#include "../../TSynth/mixer_ts.cpp"
+#include "../../TSynth/filter_variable.cpp"
+#include "../../TSynth/effect_envelope.cpp"
+
+void setUp() {}
+void tearDown() {}
+
+static int16_t saw(uint32_t t, void *context)
+{
+    const float phase = fmodf(t * 220.0f / AUDIO_SAMPLE_RATE_EXACT, 1.0f);
+    return (int16_t)((phase * 2.0f - 1.0f) * 12000.0f);
+}
+
+static int16_t noise(uint32_t t, void *context)
+{
+    return (int16_t)(rand() % 16000 - 8000);
+}
+
+// A held level, tagged as the envelope generator or a mixer would tag it
+class ConstantSource : public AudioStream
+{
+public:
+    ConstantSource(int16_t v, bool t) : AudioStream(0, NULL), value(v), tagged(t)
+    {
+        active = true;
+    }
+    virtual void update(void)
+    {
+        audio_block_t *block = allocate();
+        if (!block)
+            return;
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+            block->data[i] = value;
+        if (tagged)
+            AudioBlockTags::tag(block, AUDIO_BLOCK_TAG_CONSTANT);
+        transmit(block);
+        AudioBlockTags::release(block);
+    }
+    int16_t value;
+    bool tagged;
+};
+
+// AudioTestSink that also counts constant tagged blocks
+class TagSink : public AudioStream
+{
+public:
+    TagSink() : AudioStream(1, inputQueueArray), constant(0) {}
+    virtual void update(void)
+    {
+        audio_block_t *block = receiveReadOnly(0);
+        if (!block)
+        {
+            samples.insert(samples.end(), AUDIO_BLOCK_SAMPLES, 0);
+            return;
+        }
+        if (AudioBlockTags::isConstant(block))
+            constant++;
+        tags.push_back(AudioBlockTags::isConstant(block));
+        samples.insert(samples.end(), block->data, block->data + AUDIO_BLOCK_SAMPLES);
+        AudioBlockTags::release(block);
+    }
+    std::vector<int16_t> samples;
+    std::vector<bool> tags;
+    unsigned int constant;
+
+private:
+    audio_block_t *inputQueueArray[1];
+};
+
+// Takes every free block and checks none of them kept a tag
+class PoolProbe : public AudioStream
+{
+public:
+    static bool untagged()
+    {
+        audio_block_t *taken[NATIVE_AUDIO_MAX_BLOCKS];
+        unsigned int n = 0;
+        bool clean = true;
+        while ((taken[n] = allocate()) != NULL)
+        {
+            if (taken[n]->reserved1 != AUDIO_BLOCK_TAG_NONE)
+                clean = false;
+            n++;
+        }
+        while (n)
+            release(taken[--n]);
+        return clean;
+    }
+    // Leave a tag on every free block, as uninitialised DMAMEM might
+    static void dirty()
+    {
+        audio_block_t *taken[NATIVE_AUDIO_MAX_BLOCKS];
+        unsigned int n = 0;
+        while ((taken[n] = allocate()) != NULL)
+            taken[n++]->reserved1 = AUDIO_BLOCK_TAG_CONSTANT;
+        while (n)
+            release(taken[--n]);
+    }
+};
+
+// A voice's modulation path: envelope level and keytracking into
+// filterModMixer_, the LFO channel turned down, noise at zero level
+struct TagPath
+{
+    AudioTestSource audio{saw};
+    AudioTestSource lfo{noise};
+    ConstantSource envelope;
+    ConstantSource keytrack;
+    AudioMixer4TS modMixer;
+    AudioFilterStateVariableTS filter;
+    TagSink control;
+    TagSink out;
+    AudioConnection c0{envelope, 0, modMixer, 0};
+    AudioConnection c1{lfo, 0, modMixer, 1};
+    AudioConnection c2{keytrack, 0, modMixer, 2};
+    AudioConnection c3{audio, 0, filter, 0};
+    AudioConnection c4{modMixer, 0, filter, 1};
+    AudioConnection c5{modMixer, 0, control, 0};
+    AudioConnection c6{filter, 0, out, 0};
+
+    TagPath(bool tagged) : envelope(9000, tagged), keytrack(-2000, tagged)
+    {
+        modMixer.gain(0, 0.8f);
+        modMixer.gain(1, 0.0f);
+        modMixer.gain(2, 1.0f);
+        filter.frequency(500.0f);
+        filter.resonance(3.0f);
+        filter.octaveControl(5.0f);
+    }
+
+    void run(int blocks)
+    {
+        for (int b = 0; b < blocksOf128(blocks); b++)
+            AudioStream::update_all();
+    }
+};
+
+void test_constant_path_is_exact()
+{
+    AudioMemory(32);
+    std::vector<int16_t> reference, referenceControl;
+    {
+        TagPath path(false);
+        path.run(50);
+        reference = path.out.samples;
+        referenceControl = path.control.samples;
+        // nothing to tell the untagged levels from audio
+        TEST_ASSERT_EQUAL_INT(0, path.control.constant);
+    }
+    AudioBlockTags::skipped = 0;
+    TagPath path(true);
+    path.run(50);
+    TEST_ASSERT_EQUAL_INT(reference.size(), path.out.samples.size());
+    TEST_ASSERT_EQUAL_INT16_ARRAY(reference.data(), path.out.samples.data(), reference.size());
+    TEST_ASSERT_EQUAL_INT16_ARRAY(referenceControl.data(), path.control.samples.data(), referenceControl.size());
+    TEST_ASSERT_EQUAL_INT(blocksOf128(50), path.control.constant);
+    // per block: the LFO channel, two constant inputs and the filter's
+    // control scan
+    std::cout << "skipped sample operations per block: " << AudioBlockTags::skipped / blocksOf128(50) << std::endl;
+    TEST_ASSERT_EQUAL_INT(50 * 4 * 128, AudioBlockTags::skipped);
+    TEST_ASSERT_TRUE(PoolProbe::untagged());
+}
+
+void test_constants_fold_into_audio()
+{
+    AudioMemory(32);
+    for (int tagged = 0; tagged < 2; tagged++)
+    {
+        AudioTestSource audio(saw);
+        ConstantSource level(3000, tagged), zero(0, tagged);
+        AudioMixer4TS mixer;
+        TagSink out;
+        AudioConnection c0(audio, 0, mixer, 0);
+        AudioConnection c1(level, 0, mixer, 1);
+        AudioConnection c2(zero, 0, mixer, 2);
+        AudioConnection c3(mixer, 0, out, 0);
+        mixer.gain(0, 0.5f);
+        mixer.gain(1, 1.5f);
+        mixer.gain(2, 0.7f);
+        for (int b = 0; b < blocksOf128(20); b++)
+            AudioStream::update_all();
+        TEST_ASSERT_EQUAL_INT(0, out.constant);
+        for (size_t i = 0; i < out.samples.size(); i++)
+            TEST_ASSERT_EQUAL_INT16((saw(i, NULL) >> 1) + 4500, out.samples[i]);
+    }
+    TEST_ASSERT_TRUE(PoolProbe::untagged());
+}
+
+void test_envelope_tags_sustain()
+{
+    AudioMemory(16);
+    const int8_t types[] = {-128, 0};
+    for (int8_t type : types)
+    {
+        AudioEffectEnvelopeTS env;
+        TagSink out;
+        AudioConnection c(env, 0, out, 0);
+        env.close();
+        env.setEnvType(type);
+        env.generator(true);
+        env.attack(5.0f);
+        env.decay(10.0f);
+        env.sustain(0.5f);
+        env.release(20.0f);
+        env.noteOn();
+        const unsigned int blocks = blocksOf128(200);
+        for (unsigned int b = 0; b < blocks; b++)
+            AudioStream::update_all();
+        // every tagged block is a held level, and the sustain is tagged
+        const unsigned int held = out.constant;
+        for (size_t b = 0; b < out.tags.size(); b++)
+        {
+            const int16_t *p = &out.samples[b * AUDIO_BLOCK_SAMPLES];
+            bool flat = true;
+            for (int i = 1; i < AUDIO_BLOCK_SAMPLES; i++)
+                flat = flat && p[i] == p[0];
+            if (out.tags[b])
+                TEST_ASSERT_TRUE(flat);
+        }
+        TEST_ASSERT_TRUE(out.tags.back());
+        std::cout << (type ? "linear" : "exponential") << ": " << held << " of " << blocks << " blocks tagged" << std::endl;
+        TEST_ASSERT_GREATER_THAN(blocks * 3 / 4, held);
+        TEST_ASSERT_TRUE(PoolProbe::untagged());
+    }
+}
+
+void test_begin_clears_pool()
+{
+    AudioMemory(16);
+    PoolProbe::dirty();
+    TEST_ASSERT_FALSE(PoolProbe::untagged());
+    AudioBlockTags::begin();
+    TEST_ASSERT_EQUAL_INT(0, AudioMemoryUsage());
+    TEST_ASSERT_EQUAL_INT(0, AudioMemoryUsageMax());
+    TEST_ASSERT_TRUE(PoolProbe::untagged());
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_constant_path_is_exact);
+    RUN_TEST(test_constants_fold_into_audio);
+    RUN_TEST(test_envelope_tags_sustain);
+    RUN_TEST(test_begin_clears_pool);
+    UNITY_END();
+}
@@ -0,0 +1,116 @@
+//
+// Global as the synth builds it: its objects checked against SynthGraph's
+// schedule, by Global::inUpdateOrder() and by the order the native
+// AudioStream actually updates them in, which is what AudioMemory() is
+// planned for.
+//
+#include <unity.h>
+#include <iostream>
+#include <map>
+#include <vector>
+#include "AudioStream.h"
+#include "../../TSynth/effect_envelope.h"
+#include "../../TSynth/effect_ensemble.h"
+#include "../../TSynth/filter_dcblock.h"
+#include "../../TSynth/filter_ladder.h"
+#include "../../TSynth/filter_variable.h"
+#include "../../TSynth/mixer_bus.h"
+#include "../../TSynth/mixer_ts.h"
+#include "../../TSynth/synth_dc.h"
+#include "../../TSynth/synth_waveform.h"
+
+// Tables from the Teensy Audio library, nothing here plays
+extern "C" {
+const int16_t AudioWaveformSine[257] = {0};
+const int16_t step_table[258] = {0};
+}
+
+// The Teensy Audio library objects and the scope, only their place in
+// the update list matters here
+class LibraryNode : public AudioStream
+{
+public:
+    LibraryNode() : AudioStream(4, inputQueueArray) {}
+    virtual void update(void) {}
+    void gain(unsigned int, float) {}
+    void amplitude(float) {}
+
+private:
+    audio_block_t *inputQueueArray[4];
+};
+
+struct AudioMixer4 : LibraryNode {};
+struct AudioSynthNoisePink : LibraryNode {};
+struct AudioSynthNoiseWhite : LibraryNode {};
+struct AudioAnalyzePeak : LibraryNode {};
+struct Oscilloscope : LibraryNode {};
+struct AudioOutputUSB : LibraryNode {};
+struct AudioOutputI2S : LibraryNode {};
+struct AudioControlSGTL5000 {};
+
+#include "../../TSynth/AudioPatching.h"
+// After AudioPatching.h, their macros would clash with it
+#include "../../TSynth/block_tags.cpp"
+#include "../../TSynth/Detune.cpp"
+#include "../../TSynth/effect_envelope.cpp"
+#include "../../TSynth/effect_ensemble.cpp"
+#include "../../TSynth/filter_dcblock.cpp"
+#include "../../TSynth/filter_ladder.cpp"
+#include "../../TSynth/filter_variable.cpp"
+#include "../../TSynth/mixer_bus.cpp"
+#include "../../TSynth/mixer_ts.cpp"
+#include "../../TSynth/synth_dc.cpp"
+#include "../../TSynth/synth_waveform.cpp"
+
+// Each object's place in the order update_all() runs them in
+static std::map<const AudioStream *, unsigned int> updatePositions()
+{
+    std::map<const AudioStream *, unsigned int> at;
+    for (unsigned int i = 0; i < AudioStream::update_count(); i++)
+        at[AudioStream::update_list(i)] = i;
+    return at;
+}
+
+typedef Global::Graph Graph;
+
+void setUp() {}
+void tearDown() {}
+
+void test_global_in_update_order()
+{
+    static Global global(0.5f);
+    TEST_ASSERT_TRUE(global.inUpdateOrder());
+
+    // Every graph node is an object that update_all() reaches in the
+    // schedule's order
+    static constexpr auto schedule = Graph::schedule();
+    const auto at = updatePositions();
+    const uint8_t instances[] = {1, global.maxTimbre(), global.maxVoices(), global.maxTimbre(), 1};
+    const uint8_t nodes[] = {SynthGraph::NOISE_NODES, SynthGraph::MODULATION_NODES, SynthGraph::VOICE_NODES,
+                             SynthGraph::BUS_NODES, SynthGraph::OUTPUT_NODES};
+    std::vector<int> position(Graph::NODES, -1);
+    for (uint8_t g = SynthGraph::NOISE; g <= SynthGraph::OUTPUT; g++)
+    {
+        for (uint8_t i = 0; i < instances[g]; i++)
+        {
+            for (uint8_t id = 0; id < nodes[g]; id++)
+            {
+                const SynthGraph::Group group = (SynthGraph::Group)g;
+                const auto found = at.find(&global.node(group, i, id));
+                TEST_ASSERT_TRUE(found != at.end());
+                position[schedule.step[Graph::nodeIndex(group, i, id)]] = found->second;
+            }
+        }
+    }
+    for (size_t s = 1; s < Graph::NODES; s++)
+        TEST_ASSERT_GREATER_THAN(position[s - 1], position[s]);
+    std::cout << Graph::NODES << " objects in update order, AudioMemory(" << Global::AUDIO_MEMORY_BLOCKS << ")"
+              << std::endl;
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_global_in_update_order);
+    UNITY_END();
+}
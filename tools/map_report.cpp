@@ -0,0 +1,48 @@
+//
+// Memory use per module of a Teensy 4.1 build, from the linker map. The
+// teensy41 environment writes it next to the firmware, build this on the
+// host and run it after the build:
+//
+//   g++ -O2 -o map_report tools/map_report.cpp
+//   ./map_report .pio/build/teensy41/firmware.map
+//
+// -a adds up each library archive as one module, -n sets how many modules
+// are listed (30).
+//
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include "map_report.h"
+
+int main(int argc, char **argv)
+{
+    const char *path = nullptr;
+    bool archives = false;
+    size_t top = 30;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-a") == 0) {
+            archives = true;
+        } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            top = strtoul(argv[++i], nullptr, 10);
+        } else {
+            path = argv[i];
+        }
+    }
+    if (!path) {
+        std::cerr << "usage: map_report [-a] [-n modules] firmware.map" << std::endl;
+        return 2;
+    }
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "can't read " << path << std::endl;
+        return 1;
+    }
+    const MapReport::Report report = MapReport::parse(in, archives);
+    if (report.modules.empty()) {
+        std::cerr << path << " has no memory map" << std::endl;
+        return 1;
+    }
+    MapReport::print(std::cout, report, top);
+    return 0;
+}
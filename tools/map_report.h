@@ -0,0 +1,194 @@
+#ifndef TSYNTH_MAP_REPORT_H
+#define TSYNTH_MAP_REPORT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Reads the GNU ld map of a Teensy 4.1 build and adds up the bytes each
+// object file puts in ITCM, DTCM, OCRAM, flash and external RAM, by the
+// address each of its sections was linked at. See memory_placement.h for
+// what should go where.
+namespace MapReport {
+
+enum Region { ITCM, DTCM, OCRAM, FLASH, EXTMEM, REGIONS };
+static const char *const REGION_NAMES[REGIONS] = {"ITCM", "DTCM", "OCRAM", "Flash", "EXTMEM"};
+
+static const uint64_t RAM1_SIZE = 512 * 1024;
+static const uint64_t ITCM_BANK = 32 * 1024;
+
+// Teensy 4.1 memory map, -1 outside it
+inline int region(uint64_t address)
+{
+    if (address < 0x80000) return ITCM;
+    if (address >= 0x20000000 && address < 0x20080000) return DTCM;
+    if (address >= 0x20200000 && address < 0x20280000) return OCRAM;
+    if (address >= 0x60000000 && address < 0x61000000) return FLASH;
+    if (address >= 0x70000000 && address < 0x71000000) return EXTMEM;
+    return -1;
+}
+
+struct Usage {
+    uint64_t bytes[REGIONS] = {};
+
+    uint64_t ram1() const { return bytes[ITCM] + bytes[DTCM]; }
+    uint64_t all() const
+    {
+        uint64_t sum = 0;
+        for (uint64_t b : bytes) sum += b;
+        return sum;
+    }
+};
+
+struct Report {
+    std::map<std::string, Usage> modules;
+    Usage total;  // from the output sections, padding included
+};
+
+// An object file by its name, "libAudio.a(synth_sine.cpp)" for an archive
+// member or just "libAudio.a" when grouping by archive
+inline std::string moduleName(const std::string &file, bool archives)
+{
+    std::string path = file, member;
+    const size_t open = file.find('(');
+    if (open != std::string::npos && file.back() == ')') {
+        path = file.substr(0, open);
+        member = file.substr(open + 1, file.size() - open - 2);
+    }
+    const size_t slash = path.find_last_of("/\\");
+    std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+    if (member.empty()) {
+        if (name.size() > 2 && name.compare(name.size() - 2, 2, ".o") == 0) name.resize(name.size() - 2);
+        return name;
+    }
+    if (archives) return name;
+    if (member.size() > 2 && member.compare(member.size() - 2, 2, ".o") == 0) member.resize(member.size() - 2);
+    return name + "(" + member + ")";
+}
+
+inline bool isHex(const std::string &s)
+{
+    return s.size() > 2 && s[0] == '0' && s[1] == 'x' && s.find_first_not_of("0123456789abcdefABCDEF", 2) == std::string::npos;
+}
+
+// Sections that aren't loaded into the target
+inline bool isDebug(const std::string &section)
+{
+    static const char *const prefixes[] = {".debug", ".comment", ".ARM.attributes", ".stab", ".note"};
+    for (const char *p : prefixes) {
+        if (section.compare(0, std::string(p).size(), p) == 0) return true;
+    }
+    return false;
+}
+
+// An output section starts in the first column, an input section after
+// one space, and either can have its name alone on a line when it's long,
+// with the address and size on the next
+inline Report parse(std::istream &in, bool archives)
+{
+    Report report;
+    std::string line, pending, output;
+    bool pendingIsOutput = false;
+    bool started = false;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (!started) {
+            started = line.compare(0, 29, "Linker script and memory map") == 0;
+            continue;
+        }
+        if (line.empty()) continue;
+        std::istringstream fields(line);
+        std::vector<std::string> tokens;
+        for (std::string t; fields >> t;) tokens.push_back(t);
+        if (tokens.empty()) continue;
+
+        const bool isOutput = line[0] != ' ';
+        const bool isInput = !isOutput && line.size() > 1 && line[1] != ' ';
+        std::string name;
+        size_t at = 0;
+        bool outputLine = isOutput;
+        if (isOutput || isInput) {
+            name = tokens[0];
+            at = 1;
+            if (tokens.size() == 1) {
+                pending = name;
+                pendingIsOutput = isOutput;
+                if (isOutput) output = name;
+                continue;
+            }
+        } else if (!pending.empty()) {
+            name = pending;
+            outputLine = pendingIsOutput;
+        } else {
+            continue;
+        }
+        pending.clear();
+        if (tokens.size() < at + 2 || !isHex(tokens[at]) || !isHex(tokens[at + 1])) continue;
+
+        const uint64_t address = std::stoull(tokens[at], nullptr, 16);
+        const uint64_t size = std::stoull(tokens[at + 1], nullptr, 16);
+        if (outputLine) output = name;
+        if (size == 0 || output.empty() || output[0] != '.' || isDebug(output)) continue;
+        const int r = region(address);
+        if (r < 0) continue;
+        if (outputLine) {
+            report.total.bytes[r] += size;
+            continue;
+        }
+        if (tokens.size() < at + 3 || name == "*fill*") continue;
+        std::string file = tokens[at + 2];
+        for (size_t t = at + 3; t < tokens.size(); t++) file += " " + tokens[t];
+        report.modules[moduleName(file, archives)].bytes[r] += size;
+    }
+    return report;
+}
+
+inline void printRow(std::ostream &out, const std::string &name, const Usage &u)
+{
+    out << std::left << std::setw(40) << name << std::right;
+    for (uint64_t b : u.bytes) out << std::setw(9) << b;
+    out << "\n";
+}
+
+// The region totals, then the modules taking the most RAM1 (ITCM and DTCM
+// share it), the rest added up on one line
+inline void print(std::ostream &out, const Report &report, size_t top)
+{
+    const Usage &t = report.total;
+    const uint64_t banks = (t.bytes[ITCM] + ITCM_BANK - 1) / ITCM_BANK;
+    const uint64_t ram1 = banks * ITCM_BANK + t.bytes[DTCM];
+    out << "ITCM  " << t.bytes[ITCM] << " in " << banks << " x 32 KB banks\n";
+    out << "DTCM  " << t.bytes[DTCM] << ", RAM1 left for the stack: "
+        << (ram1 < RAM1_SIZE ? RAM1_SIZE - ram1 : 0) << "\n";
+    out << "OCRAM " << t.bytes[OCRAM] << " of " << 512 * 1024 << ", the rest is heap\n";
+    out << "Flash " << t.bytes[FLASH] << " FLASHMEM and PROGMEM (ITCM and DTCM are copied from flash too)\n";
+    if (t.bytes[EXTMEM]) out << "EXTMEM " << t.bytes[EXTMEM] << "\n";
+    out << "\n";
+
+    std::vector<std::pair<std::string, Usage>> rows(report.modules.begin(), report.modules.end());
+    std::stable_sort(rows.begin(), rows.end(), [](const std::pair<std::string, Usage> &a, const std::pair<std::string, Usage> &b) {
+        return a.second.ram1() != b.second.ram1() ? a.second.ram1() > b.second.ram1() : a.second.all() > b.second.all();
+    });
+    out << std::left << std::setw(40) << "module" << std::right;
+    for (const char *r : REGION_NAMES) out << std::setw(9) << r;
+    out << "\n";
+    Usage rest;
+    for (size_t i = 0; i < rows.size(); i++) {
+        if (i < top) {
+            printRow(out, rows[i].first, rows[i].second);
+        } else {
+            for (int r = 0; r < REGIONS; r++) rest.bytes[r] += rows[i].second.bytes[r];
+        }
+    }
+    if (rows.size() > top) printRow(out, "(" + std::to_string(rows.size() - top) + " more)", rest);
+}
+
+}
+
+#endif